@@ -3,50 +3,169 @@
 //
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
 
-#define MAX_SIZE 100
-int parent[MAX_SIZE];
-int rank_arr[MAX_SIZE];
+#include "DSU.h"
 
 /**
- * @brief Initializes the DSU structure for 'n' elements (0 to n-1).
+ * @brief One undo log entry of a rollback-mode DSU.
  */
-void dsu_init(int n) {
-    for (int i = 0; i < n; i++) {
-        parent[i] = i;
-        rank_arr[i] = 0;
-    }
-}
+typedef struct {
+    int32_t child;      ///< The root that was linked under another root.
+    int32_t child_size; ///< Its negated set size before the link.
+} DSUUndo;
 
 /**
- * @brief Finds the representative (root) of the set containing element 'i'.
- * Uses Path Compression.
+ * @brief DSU structure definition.
+ * * parent[i] >= 0 is the parent index of element i, while a root stores the
+ * negated size of its set. Parent links and set sizes therefore share a
+ * single 32-bit array, which keeps finds on large inputs cache-dense.
  */
-int dsu_find(int i) {
-    if (parent[i] == i) {
-        return i;
+struct DSU {
+    int32_t *parent;
+    size_t n;      ///< Number of elements.
+    size_t count;  ///< Number of disjoint sets.
+    bool rollback; ///< Rollback mode: no path halving, unions are logged.
+    DSUUndo *undo; ///< Undo log, one entry per successful union.
+    size_t undo_size;
+    size_t undo_capacity;
+};
+
+DSU *dsu_new(size_t n) {
+    if (n == 0 || n > INT32_MAX) {
+        fprintf(stderr, "DSU size must be in [1, INT32_MAX]!\n");
+        return NULL;
     }
-    return parent[i] = dsu_find(parent[i]);
+
+    DSU *dsu = malloc(sizeof(DSU));
+    if (!dsu) {
+        fprintf(stderr, "DSU allocation failed!\n");
+        return NULL;
+    }
+
+    dsu->parent = malloc(sizeof(int32_t) * n);
+    if (!dsu->parent) {
+        fprintf(stderr, "DSU parent allocation failed!\n");
+        free(dsu);
+        return NULL;
+    }
+
+    dsu->n = n;
+    dsu->rollback = false;
+    dsu->undo = NULL;
+    dsu->undo_size = 0;
+    dsu->undo_capacity = 0;
+    dsu_reset(dsu);
+    return dsu;
 }
 
-/**
- * @brief Merges the sets containing elements 'i' and 'j'.
- * Uses Union by Rank.
- */
-int dsu_union(int i, int j) {
-    int root_i = dsu_find(i);
-    int root_j = dsu_find(j);
-
-    if (root_i != root_j) {
-        if (rank_arr[root_i] < rank_arr[root_j]) {
-            parent[root_i] = root_j;
-        } else if (rank_arr[root_i] > rank_arr[root_j]) {
-            parent[root_j] = root_i;
-        } else {
-            parent[root_j] = root_i;
-            rank_arr[root_i]++;
+DSU *dsu_new_rollback(size_t n) {
+    DSU *dsu = dsu_new(n);
+    if (dsu) {
+        dsu->rollback = true;
+    }
+    return dsu;
+}
+
+void dsu_free(DSU *dsu) {
+    if (dsu) {
+        free(dsu->parent);
+        free(dsu->undo);
+        free(dsu);
+    }
+}
+
+void dsu_reset(DSU *dsu) {
+    for (size_t i = 0; i < dsu->n; i++) {
+        dsu->parent[i] = -1;
+    }
+    dsu->count = dsu->n;
+    dsu->undo_size = 0;
+}
+
+size_t dsu_find(DSU *dsu, size_t i) {
+    int32_t *parent = dsu->parent;
+    int32_t x = (int32_t)i;
+
+    // Rollback mode must not rewrite links, otherwise unions could not be undone.
+    if (dsu->rollback) {
+        while (parent[x] >= 0) {
+            x = parent[x];
+        }
+        return (size_t)x;
+    }
+
+    // Path Halving: every visited node is re-linked to its grandparent.
+    while (parent[x] >= 0) {
+        int32_t p = parent[x];
+        int32_t gp = parent[p];
+        if (gp < 0) {
+            return (size_t)p;
         }
-        return 1;
+        parent[x] = gp;
+        x = gp;
+    }
+    return (size_t)x;
+}
+
+int dsu_union(DSU *dsu, size_t i, size_t j) {
+    int32_t root_i = (int32_t)dsu_find(dsu, i);
+    int32_t root_j = (int32_t)dsu_find(dsu, j);
+
+    if (root_i == root_j) {
+        return 0;
     }
-    return 0;
-}
\ No newline at end of file
+
+    // Sizes are stored negated, so the larger set has the smaller value.
+    if (dsu->parent[root_i] > dsu->parent[root_j]) {
+        int32_t temp = root_i;
+        root_i = root_j;
+        root_j = temp;
+    }
+    if (dsu->rollback) {
+        if (dsu->undo_size == dsu->undo_capacity) {
+            size_t new_capacity = dsu->undo_capacity ? dsu->undo_capacity * 2 : 64;
+            DSUUndo *new_undo = realloc(dsu->undo, sizeof(DSUUndo) * new_capacity);
+            if (!new_undo) {
+                fprintf(stderr, "DSU undo log allocation failed!\n");
+                return -1;
+            }
+            dsu->undo = new_undo;
+            dsu->undo_capacity = new_capacity;
+        }
+        dsu->undo[dsu->undo_size++] = (DSUUndo){root_j, dsu->parent[root_j]};
+    }
+    dsu->parent[root_i] += dsu->parent[root_j];
+    dsu->parent[root_j] = root_i;
+    dsu->count--;
+    return 1;
+}
+
+size_t dsu_set_size(DSU *dsu, size_t i) {
+    return (size_t)(-dsu->parent[dsu_find(dsu, i)]);
+}
+
+size_t dsu_count(const DSU *dsu) {
+    return dsu->count;
+}
+
+size_t dsu_snapshot(const DSU *dsu) {
+    return dsu->undo_size;
+}
+
+void dsu_rollback(DSU *dsu, size_t snapshot) {
+    if (!dsu->rollback) {
+        fprintf(stderr, "Error: DSU was not created in rollback mode!\n");
+        return;
+    }
+    // Undo the newest unions first; each one only touched two roots.
+    while (dsu->undo_size > snapshot) {
+        DSUUndo entry = dsu->undo[--dsu->undo_size];
+        int32_t root = dsu->parent[entry.child];
+        dsu->parent[root] -= entry.child_size;
+        dsu->parent[entry.child] = entry.child_size;
+        dsu->count++;
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ *  Disjoint Set Union (Union-Find) on dense element indices 0..n-1.
+ */
+
+#ifndef TEMPLATE_DSU_H
+#define TEMPLATE_DSU_H
+
+#include <stddef.h>
+
+typedef struct DSU DSU;
+
+/**
+ * @brief Creates a DSU holding 'n' singleton sets {0}, {1}, ..., {n-1}.
+ * @param n The number of elements (at most INT32_MAX).
+ * @return DSU* The new DSU, or NULL on failure.
+ */
+DSU *dsu_new(size_t n);
+/**
+ * @brief Creates a DSU in rollback mode.
+ * * Finds do not compress paths and every successful union is recorded on an
+ * undo log, so that dsu_rollback can restore any earlier dsu_snapshot. Union
+ * by size still bounds every tree height by O(log n).
+ * @param n The number of elements (at most INT32_MAX).
+ * @return DSU* The new DSU, or NULL on failure.
+ */
+DSU *dsu_new_rollback(size_t n);
+/**
+ * @brief Frees all memory associated with the DSU.
+ * @param dsu The DSU to be freed.
+ */
+void dsu_free(DSU *dsu);
+/**
+ * @brief Puts every element back into its own singleton set and clears the undo log.
+ * @param dsu The DSU to be reset.
+ */
+void dsu_reset(DSU *dsu);
+/**
+ * @brief Finds the representative (root) of the set containing element 'i'.
+ * Uses iterative Path Halving (plain traversal in rollback mode).
+ * @param dsu The DSU to be queried.
+ * @param i The element index.
+ * @return size_t The root of the set containing i.
+ */
+size_t dsu_find(DSU *dsu, size_t i);
+/**
+ * @brief Merges the sets containing elements 'i' and 'j'. Uses Union by Size.
+ * @param dsu The DSU to be modified.
+ * @param i The first element index.
+ * @param j The second element index.
+ * @return int 1 if the union was successful (they were in different sets), 0 if they were
+ * already in the same set, -1 if the undo log could not grow (rollback mode only; nothing is merged).
+ */
+int dsu_union(DSU *dsu, size_t i, size_t j);
+/**
+ * @brief Returns the number of elements in the set containing element 'i'.
+ */
+size_t dsu_set_size(DSU *dsu, size_t i);
+/**
+ * @brief Returns the current number of disjoint sets.
+ */
+size_t dsu_count(const DSU *dsu);
+/**
+ * @brief Returns a snapshot of a rollback-mode DSU (the current undo log length).
+ */
+size_t dsu_snapshot(const DSU *dsu);
+/**
+ * @brief Undoes every union made after 'snapshot' was taken, in O(1) per union.
+ * @param dsu A DSU created with dsu_new_rollback.
+ * @param snapshot A value previously returned by dsu_snapshot.
+ */
+void dsu_rollback(DSU *dsu, size_t snapshot);
+
+#endif //TEMPLATE_DSU_H
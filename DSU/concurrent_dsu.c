@@ -0,0 +1,155 @@
+/*
+ *  Lock-free concurrent Disjoint Set Union (Jayanti & Tarjan style).
+ *
+ *  Each root points to itself. A union links one root under another with a
+ *  single CAS, which fails (and the union retries) if that root was linked
+ *  by someone else in the meantime. Roots are linked by a fixed pseudo-random
+ *  priority derived from their index, which plays the role of union by rank
+ *  without needing a second word per element that would have to be updated
+ *  atomically together with the parent.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "concurrent_dsu.h"
+
+struct ConcurrentDSU {
+    _Atomic uint32_t *parent;
+    size_t n;
+};
+
+/**
+ * @brief Fixed linking priority of an element (a 32-bit integer mixer).
+ */
+static inline uint32_t priority(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352DU;
+    x ^= x >> 15;
+    x *= 0x846CA68BU;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @brief Returns true if root 'a' must be linked under root 'b'.
+ */
+static inline int links_below(uint32_t a, uint32_t b) {
+    uint32_t pa = priority(a);
+    uint32_t pb = priority(b);
+    return pa < pb || (pa == pb && a < b);
+}
+
+ConcurrentDSU *cdsu_new(size_t n) {
+    if (n == 0 || n > UINT32_MAX) {
+        fprintf(stderr, "ConcurrentDSU size must be in [1, UINT32_MAX]!\n");
+        return NULL;
+    }
+
+    ConcurrentDSU *dsu = malloc(sizeof(ConcurrentDSU));
+    if (!dsu) {
+        fprintf(stderr, "ConcurrentDSU allocation failed!\n");
+        return NULL;
+    }
+
+    dsu->parent = malloc(sizeof(_Atomic uint32_t) * n);
+    if (!dsu->parent) {
+        fprintf(stderr, "ConcurrentDSU parent allocation failed!\n");
+        free(dsu);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        atomic_init(&dsu->parent[i], (uint32_t)i);
+    }
+    dsu->n = n;
+    return dsu;
+}
+
+void cdsu_free(ConcurrentDSU *dsu) {
+    if (dsu) {
+        free(dsu->parent);
+        free(dsu);
+    }
+}
+
+size_t cdsu_find(ConcurrentDSU *dsu, size_t i) {
+    _Atomic uint32_t *parent = dsu->parent;
+    uint32_t x = (uint32_t)i;
+
+    // Path Splitting: point x at its grandparent, then continue from its old parent.
+    // A failed CAS only means another thread already shortened this link.
+    for (;;) {
+        uint32_t p = atomic_load_explicit(&parent[x], memory_order_relaxed);
+        if (p == x) {
+            return x;
+        }
+        uint32_t gp = atomic_load_explicit(&parent[p], memory_order_relaxed);
+        if (gp == p) {
+            return p;
+        }
+        atomic_compare_exchange_weak_explicit(&parent[x], &p, gp,
+                                              memory_order_relaxed, memory_order_relaxed);
+        x = p;
+    }
+}
+
+int cdsu_union(ConcurrentDSU *dsu, size_t i, size_t j) {
+    uint32_t a = (uint32_t)i;
+    uint32_t b = (uint32_t)j;
+
+    for (;;) {
+        a = (uint32_t)cdsu_find(dsu, a);
+        b = (uint32_t)cdsu_find(dsu, b);
+        if (a == b) {
+            return 0;
+        }
+        if (!links_below(a, b)) {
+            uint32_t temp = a;
+            a = b;
+            b = temp;
+        }
+        // Succeeds only while 'a' is still a root.
+        uint32_t expected = a;
+        if (atomic_compare_exchange_strong_explicit(&dsu->parent[a], &expected, b,
+                                                    memory_order_acq_rel, memory_order_relaxed)) {
+            return 1;
+        }
+    }
+}
+
+int cdsu_same(ConcurrentDSU *dsu, size_t i, size_t j) {
+    uint32_t a = (uint32_t)i;
+    uint32_t b = (uint32_t)j;
+
+    for (;;) {
+        a = (uint32_t)cdsu_find(dsu, a);
+        b = (uint32_t)cdsu_find(dsu, b);
+        if (a == b) {
+            return 1;
+        }
+        // Different roots only prove disjointness if 'a' was not linked meanwhile.
+        if (atomic_load_explicit(&dsu->parent[a], memory_order_acquire) == a) {
+            return 0;
+        }
+    }
+}
+
+size_t cdsu_union_batch(ConcurrentDSU *dsu, const uint32_t *pairs, size_t count) {
+    size_t merged = 0;
+    for (size_t e = 0; e < count; e++) {
+        merged += (size_t)cdsu_union(dsu, pairs[2 * e], pairs[2 * e + 1]);
+    }
+    return merged;
+}
+
+size_t cdsu_count(ConcurrentDSU *dsu) {
+    size_t roots = 0;
+    for (size_t i = 0; i < dsu->n; i++) {
+        if (atomic_load_explicit(&dsu->parent[i], memory_order_relaxed) == i) {
+            roots++;
+        }
+    }
+    return roots;
+}
@@ -0,0 +1,49 @@
+/*
+ *  Lock-free concurrent Disjoint Set Union.
+ *  Any number of threads may call cdsu_find / cdsu_union / cdsu_same at once.
+ */
+
+#ifndef TEMPLATE_CONCURRENT_DSU_H
+#define TEMPLATE_CONCURRENT_DSU_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct ConcurrentDSU ConcurrentDSU;
+
+/**
+ * @brief Creates a concurrent DSU holding 'n' singleton sets.
+ * @param n The number of elements (at most UINT32_MAX).
+ * @return ConcurrentDSU* The new DSU, or NULL on failure.
+ */
+ConcurrentDSU *cdsu_new(size_t n);
+/**
+ * @brief Frees all memory associated with the DSU. Not thread-safe.
+ */
+void cdsu_free(ConcurrentDSU *dsu);
+/**
+ * @brief Finds the current root of the set containing 'i'.
+ * Uses lock-free Path Splitting. The result may already be stale when a
+ * concurrent union links it; use cdsu_same for a consistent answer.
+ */
+size_t cdsu_find(ConcurrentDSU *dsu, size_t i);
+/**
+ * @brief Merges the sets containing 'i' and 'j' by linking roots with CAS.
+ * @return int 1 if this call merged two different sets, 0 otherwise.
+ */
+int cdsu_union(ConcurrentDSU *dsu, size_t i, size_t j);
+/**
+ * @brief Checks whether 'i' and 'j' are in the same set (linearizable).
+ */
+int cdsu_same(ConcurrentDSU *dsu, size_t i, size_t j);
+/**
+ * @brief Unions a batch of edges given as 'count' (u, v) pairs in 'pairs'.
+ * @return size_t The number of unions that merged two different sets.
+ */
+size_t cdsu_union_batch(ConcurrentDSU *dsu, const uint32_t *pairs, size_t count);
+/**
+ * @brief Returns the number of disjoint sets. Only exact when no union is in flight.
+ */
+size_t cdsu_count(ConcurrentDSU *dsu);
+
+#endif //TEMPLATE_CONCURRENT_DSU_H
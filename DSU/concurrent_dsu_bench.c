@@ -0,0 +1,87 @@
+/*
+ *  Random-edge benchmark for the concurrent DSU against the sequential DSU.
+ *  Usage: concurrent-dsu-bench [n] [m] [max_threads]
+ *         (default: n = 10M vertices, m = 20M edges, up to 16 threads)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "DSU.h"
+#include "concurrent_dsu.h"
+#include "../bench_util.h"
+
+typedef struct {
+    ConcurrentDSU *dsu;
+    const uint32_t *pairs;
+    size_t count;
+} Batch;
+
+static void *run_batch(void *arg) {
+    Batch *batch = arg;
+    cdsu_union_batch(batch->dsu, batch->pairs, batch->count);
+    return NULL;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    size_t m = argc > 2 ? strtoull(argv[2], NULL, 10) : 20000000;
+    int max_threads = argc > 3 ? atoi(argv[3]) : 16;
+
+    uint32_t *pairs = malloc(sizeof(uint32_t) * 2 * m);
+    if (!pairs) {
+        fprintf(stderr, "Edge allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 7;
+    for (size_t e = 0; e < 2 * m; e++) {
+        pairs[e] = (uint32_t)(next_rand(&state) % n);
+    }
+
+    DSU *seq = dsu_new(n);
+    if (!seq) return 1;
+    double start = now_sec();
+    for (size_t e = 0; e < m; e++) {
+        dsu_union(seq, pairs[2 * e], pairs[2 * e + 1]);
+    }
+    double seq_time = now_sec() - start;
+    size_t expected_sets = dsu_count(seq);
+    dsu_free(seq);
+    printf("n=%zu m=%zu  sequential DSU: %.3f s (%.2f M unions/s), sets=%zu\n",
+           n, m, seq_time, (double)m / seq_time / 1e6, expected_sets);
+
+    pthread_t threads[256];
+    Batch batches[256];
+    if (max_threads > 256) max_threads = 256;
+
+    for (int t = 1; t <= max_threads; t *= 2) {
+        ConcurrentDSU *dsu = cdsu_new(n);
+        if (!dsu) return 1;
+
+        size_t chunk = (m + (size_t)t - 1) / (size_t)t;
+        start = now_sec();
+        for (int k = 0; k < t; k++) {
+            size_t lo = chunk * (size_t)k < m ? chunk * (size_t)k : m;
+            size_t hi = lo + chunk < m ? lo + chunk : m;
+            batches[k] = (Batch){dsu, pairs + 2 * lo, hi - lo};
+            pthread_create(&threads[k], NULL, run_batch, &batches[k]);
+        }
+        for (int k = 0; k < t; k++) {
+            pthread_join(threads[k], NULL);
+        }
+        double time = now_sec() - start;
+
+        size_t sets = cdsu_count(dsu);
+        printf("threads=%3d  concurrent DSU: %.3f s (%.2f M unions/s, %.2fx vs sequential)%s\n",
+               t, time, (double)m / time / 1e6, seq_time / time,
+               sets == expected_sets ? "" : "  MISMATCH");
+        cdsu_free(dsu);
+    }
+
+    free(pairs);
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ *  Throughput benchmark for the DSU: random unions followed by random finds, then the same
+ *  unions in rollback mode, undone with dsu_rollback.
+ *  Usage: dsu-bench [n ...]   (default: 1M 10M 100M elements)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "DSU.h"
+#include "../bench_util.h"
+
+static void bench(size_t n) {
+    DSU *dsu = dsu_new(n);
+    if (!dsu) return;
+
+    uint64_t state = 42;
+    size_t num_unions = n / 2;
+    double start = now_sec();
+    for (size_t i = 0; i < num_unions; i++) {
+        dsu_union(dsu, next_rand(&state) % n, next_rand(&state) % n);
+    }
+    double union_time = now_sec() - start;
+
+    size_t num_finds = n;
+    size_t checksum = 0;
+    start = now_sec();
+    for (size_t i = 0; i < num_finds; i++) {
+        checksum += dsu_find(dsu, next_rand(&state) % n);
+    }
+    double find_time = now_sec() - start;
+
+    printf("n=%10zu  unions: %7.2f M/s  finds: %7.2f M/s  sets=%zu  (checksum %zu)\n",
+           n, (double)num_unions / union_time / 1e6, (double)num_finds / find_time / 1e6,
+           dsu_count(dsu), checksum);
+    dsu_free(dsu);
+}
+
+#define ROLLBACK_SAMPLES 1024
+
+/**
+ * @brief Rollback mode: unions after a snapshot are undone, and the earlier sets must come back exactly.
+ */
+static void bench_rollback(size_t n) {
+    DSU *dsu = dsu_new_rollback(n);
+    size_t *sample = malloc(sizeof(size_t) * ROLLBACK_SAMPLES);
+    size_t *roots = malloc(sizeof(size_t) * ROLLBACK_SAMPLES);
+    if (!dsu || !sample || !roots) {
+        dsu_free(dsu);
+        free(sample);
+        free(roots);
+        return;
+    }
+
+    uint64_t state = 42;
+    size_t num_unions = n / 2;
+    size_t failed = 0;
+    double start = now_sec();
+    for (size_t i = 0; i < num_unions / 2; i++) {
+        failed += dsu_union(dsu, next_rand(&state) % n, next_rand(&state) % n) < 0;
+    }
+    size_t snapshot = dsu_snapshot(dsu);
+    size_t sets_at_snapshot = dsu_count(dsu);
+    for (size_t s = 0; s < ROLLBACK_SAMPLES; s++) {
+        sample[s] = next_rand(&state) % n;
+        roots[s] = dsu_find(dsu, sample[s]);
+    }
+    for (size_t i = num_unions / 2; i < num_unions; i++) {
+        failed += dsu_union(dsu, next_rand(&state) % n, next_rand(&state) % n) < 0;
+    }
+    double union_time = now_sec() - start;
+
+    size_t undone = dsu_snapshot(dsu) - snapshot;
+    start = now_sec();
+    dsu_rollback(dsu, snapshot);
+    double rollback_time = now_sec() - start;
+
+    size_t mismatches = dsu_count(dsu) != sets_at_snapshot;
+    for (size_t s = 0; s < ROLLBACK_SAMPLES; s++) {
+        mismatches += dsu_find(dsu, sample[s]) != roots[s];
+    }
+    dsu_rollback(dsu, 0);
+    mismatches += dsu_count(dsu) != n;
+
+    printf("n=%10zu  rollback mode unions: %7.2f M/s  undo: %7.2f M/s  (%zu unions undone)%s%s\n",
+           n, (double)num_unions / union_time / 1e6, (double)undone / rollback_time / 1e6, undone,
+           mismatches ? "  MISMATCH" : "", failed ? "  UNDO LOG FULL" : "");
+    dsu_free(dsu);
+    free(sample);
+    free(roots);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            bench((size_t)strtoull(argv[i], NULL, 10));
+            bench_rollback((size_t)strtoull(argv[i], NULL, 10));
+        }
+    } else {
+        size_t sizes[] = {1000000, 10000000, 100000000};
+        for (int i = 0; i < 3; i++) {
+            bench(sizes[i]);
+            bench_rollback(sizes[i]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ *  Hash-keyed Disjoint Set Union.
+ *
+ *  Each slot of a linear-probing table stores the key together with its
+ *  parent link, so no separate key -> index remapping is needed. As in
+ *  DSU.c, parent >= 0 is the slot index of the parent and a root stores the
+ *  negated size of its set. Finds use Path Halving and unions link by size.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hash_dsu.h"
+
+#define HDSU_EMPTY INT32_MIN        ///< Parent value marking an unused slot.
+#define HDSU_MIN_CAPACITY 16
+#define HDSU_MAX_CAPACITY (1U << 31)
+
+typedef struct {
+    uint64_t key;
+    int32_t parent;
+} HashDSUSlot;
+
+struct HashDSU {
+    HashDSUSlot *slots;
+    size_t capacity; ///< Number of slots, always a power of two.
+    size_t n;        ///< Number of stored keys.
+    size_t count;    ///< Number of disjoint sets.
+};
+
+/**
+ * @brief 64-bit finalizer (from SplitMix64) used as the table hash.
+ */
+static inline uint64_t hash_key(uint64_t key) {
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
+
+static HashDSUSlot *alloc_slots(size_t capacity) {
+    HashDSUSlot *slots = malloc(sizeof(HashDSUSlot) * capacity);
+    if (!slots) {
+        fprintf(stderr, "HashDSU table allocation failed!\n");
+        return NULL;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        slots[i].parent = HDSU_EMPTY;
+    }
+    return slots;
+}
+
+/**
+ * @brief Returns the slot holding 'key', or the empty slot where it would be inserted.
+ */
+static inline size_t probe(const HashDSU *dsu, uint64_t key) {
+    size_t mask = dsu->capacity - 1;
+    size_t i = (size_t)hash_key(key) & mask;
+    while (dsu->slots[i].parent != HDSU_EMPTY && dsu->slots[i].key != key) {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+/**
+ * @brief Doubles the table. Parent links are slot indices, so they are
+ * translated through an old -> new slot map after all keys are moved.
+ */
+static int grow(HashDSU *dsu) {
+    if (dsu->capacity >= HDSU_MAX_CAPACITY) {
+        fprintf(stderr, "HashDSU is full!\n");
+        return 0;
+    }
+
+    size_t old_capacity = dsu->capacity;
+    HashDSUSlot *old_slots = dsu->slots;
+    HashDSUSlot *new_slots = alloc_slots(old_capacity * 2);
+    int32_t *moved_to = malloc(sizeof(int32_t) * old_capacity);
+    if (!new_slots || !moved_to) {
+        free(new_slots);
+        free(moved_to);
+        return 0;
+    }
+
+    dsu->slots = new_slots;
+    dsu->capacity = old_capacity * 2;
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_slots[i].parent != HDSU_EMPTY) {
+            size_t j = probe(dsu, old_slots[i].key);
+            new_slots[j].key = old_slots[i].key;
+            new_slots[j].parent = -1; // placeholder until every key has moved
+            moved_to[i] = (int32_t)j;
+        }
+    }
+    for (size_t i = 0; i < old_capacity; i++) {
+        int32_t p = old_slots[i].parent;
+        if (p != HDSU_EMPTY) {
+            new_slots[moved_to[i]].parent = p >= 0 ? moved_to[p] : p;
+        }
+    }
+
+    free(old_slots);
+    free(moved_to);
+    return 1;
+}
+
+HashDSU *hdsu_new(size_t expected_n) {
+    HashDSU *dsu = malloc(sizeof(HashDSU));
+    if (!dsu) {
+        fprintf(stderr, "HashDSU allocation failed!\n");
+        return NULL;
+    }
+
+    // Keep the load factor at or below 1/2.
+    size_t capacity = HDSU_MIN_CAPACITY;
+    while (capacity < expected_n * 2 && capacity < HDSU_MAX_CAPACITY) {
+        capacity *= 2;
+    }
+    dsu->slots = alloc_slots(capacity);
+    if (!dsu->slots) {
+        free(dsu);
+        return NULL;
+    }
+    dsu->capacity = capacity;
+    dsu->n = 0;
+    dsu->count = 0;
+    return dsu;
+}
+
+void hdsu_free(HashDSU *dsu) {
+    if (dsu) {
+        free(dsu->slots);
+        free(dsu);
+    }
+}
+
+/**
+ * @brief Finds the root slot of slot 'x' with Path Halving.
+ */
+static inline int32_t find_slot(HashDSUSlot *slots, int32_t x) {
+    while (slots[x].parent >= 0) {
+        int32_t p = slots[x].parent;
+        int32_t gp = slots[p].parent;
+        if (gp < 0) {
+            return p;
+        }
+        slots[x].parent = gp;
+        x = gp;
+    }
+    return x;
+}
+
+uint64_t hdsu_find(HashDSU *dsu, uint64_t key) {
+    size_t i = probe(dsu, key);
+    if (dsu->slots[i].parent == HDSU_EMPTY) {
+        return key;
+    }
+    return dsu->slots[find_slot(dsu->slots, (int32_t)i)].key;
+}
+
+/**
+ * @brief Returns the slot of 'key', inserting it as a new singleton if absent.
+ * The caller guarantees a free slot is available.
+ */
+static inline int32_t lookup_or_insert(HashDSU *dsu, uint64_t key) {
+    size_t i = probe(dsu, key);
+    if (dsu->slots[i].parent == HDSU_EMPTY) {
+        dsu->slots[i].key = key;
+        dsu->slots[i].parent = -1;
+        dsu->n++;
+        dsu->count++;
+    }
+    return (int32_t)i;
+}
+
+int hdsu_union(HashDSU *dsu, uint64_t a, uint64_t b) {
+    // Up to two keys may be inserted below; grow first so slot indices stay valid.
+    if ((dsu->n + 2) * 2 > dsu->capacity && !grow(dsu)) {
+        return -1;
+    }
+
+    HashDSUSlot *slots = dsu->slots;
+    int32_t root_a = find_slot(slots, lookup_or_insert(dsu, a));
+    int32_t root_b = find_slot(slots, lookup_or_insert(dsu, b));
+    if (root_a == root_b) {
+        return 0;
+    }
+
+    if (slots[root_a].parent > slots[root_b].parent) {
+        int32_t temp = root_a;
+        root_a = root_b;
+        root_b = temp;
+    }
+    slots[root_a].parent += slots[root_b].parent;
+    slots[root_b].parent = root_a;
+    dsu->count--;
+    return 1;
+}
+
+size_t hdsu_size(const HashDSU *dsu) {
+    return dsu->n;
+}
+
+size_t hdsu_count(const HashDSU *dsu) {
+    return dsu->count;
+}
@@ -0,0 +1,44 @@
+/*
+ *  Disjoint Set Union keyed by arbitrary 64-bit identifiers.
+ *  Elements live inline in an open-addressing table and are created lazily.
+ */
+
+#ifndef TEMPLATE_HASH_DSU_H
+#define TEMPLATE_HASH_DSU_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct HashDSU HashDSU;
+
+/**
+ * @brief Creates an empty hash-keyed DSU.
+ * @param expected_n Expected number of distinct keys (0 if unknown), used to presize the table.
+ * @return HashDSU* The new DSU, or NULL on failure.
+ */
+HashDSU *hdsu_new(size_t expected_n);
+/**
+ * @brief Frees all memory associated with the DSU.
+ */
+void hdsu_free(HashDSU *dsu);
+/**
+ * @brief Finds the representative key of the set containing 'key'.
+ * A key that was never part of a union is its own singleton set.
+ * @return uint64_t The key of the set's root.
+ */
+uint64_t hdsu_find(HashDSU *dsu, uint64_t key);
+/**
+ * @brief Merges the sets containing 'a' and 'b', creating either key on first use.
+ * @return int 1 if two different sets were merged, 0 if already in the same set, -1 on allocation failure.
+ */
+int hdsu_union(HashDSU *dsu, uint64_t a, uint64_t b);
+/**
+ * @brief Returns the number of keys stored in the table.
+ */
+size_t hdsu_size(const HashDSU *dsu);
+/**
+ * @brief Returns the number of disjoint sets among the stored keys.
+ */
+size_t hdsu_count(const HashDSU *dsu);
+
+#endif //TEMPLATE_HASH_DSU_H
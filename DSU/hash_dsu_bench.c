@@ -0,0 +1,103 @@
+/*
+ *  Benchmark: hash-keyed DSU against remapping sparse 64-bit IDs to 0..V-1
+ *  and running the dense DSU.
+ *  Usage: hash-dsu-bench [num_edges] [num_vertices]
+ *         (default: 50M edges over 25M distinct vertex IDs)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "DSU.h"
+#include "hash_dsu.h"
+#include "../bench_util.h"
+
+/**
+ * @brief The remapping pass: assigns dense indices to IDs in first-seen order
+ * with a linear-probing ID -> index map.
+ * @return size_t The number of distinct IDs, or 0 on allocation failure.
+ */
+static size_t remap(const uint64_t *ids, size_t count, uint32_t *dense, size_t expected_v) {
+    size_t capacity = 16;
+    while (capacity < expected_v * 2) capacity *= 2;
+    uint64_t *keys = malloc(sizeof(uint64_t) * capacity);
+    uint32_t *values = malloc(sizeof(uint32_t) * capacity);
+    if (!keys || !values) {
+        free(keys);
+        free(values);
+        return 0;
+    }
+    for (size_t i = 0; i < capacity; i++) values[i] = UINT32_MAX;
+
+    size_t mask = capacity - 1;
+    size_t next = 0;
+    for (size_t e = 0; e < count; e++) {
+        size_t i = (size_t)splitmix64_mix(ids[e]) & mask;
+        while (values[i] != UINT32_MAX && keys[i] != ids[e]) {
+            i = (i + 1) & mask;
+        }
+        if (values[i] == UINT32_MAX) {
+            keys[i] = ids[e];
+            values[i] = (uint32_t)next++;
+        }
+        dense[e] = values[i];
+    }
+    free(keys);
+    free(values);
+    return next;
+}
+
+int main(int argc, char *argv[]) {
+    size_t m = argc > 1 ? strtoull(argv[1], NULL, 10) : 50000000;
+    size_t v = argc > 2 ? strtoull(argv[2], NULL, 10) : 25000000;
+
+    // Sparse IDs: v random 64-bit values; edge endpoints are drawn among them.
+    uint64_t *vertex_ids = malloc(sizeof(uint64_t) * v);
+    uint64_t *edges = malloc(sizeof(uint64_t) * 2 * m);
+    uint32_t *dense = malloc(sizeof(uint32_t) * 2 * m);
+    if (!vertex_ids || !edges || !dense) {
+        fprintf(stderr, "Input allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 1234;
+    for (size_t i = 0; i < v; i++) vertex_ids[i] = next_rand(&state);
+    for (size_t e = 0; e < 2 * m; e++) edges[e] = vertex_ids[next_rand(&state) % v];
+    free(vertex_ids);
+
+    // 1. Hash-keyed DSU directly on the 64-bit IDs.
+    double start = now_sec();
+    HashDSU *hdsu = hdsu_new(v);
+    if (!hdsu) return 1;
+    for (size_t e = 0; e < m; e++) {
+        hdsu_union(hdsu, edges[2 * e], edges[2 * e + 1]);
+    }
+    double hash_time = now_sec() - start;
+    size_t hash_sets = hdsu_count(hdsu);
+    size_t hash_keys = hdsu_size(hdsu);
+    hdsu_free(hdsu);
+
+    // 2. Remap to dense indices, then the dense DSU.
+    start = now_sec();
+    size_t distinct = remap(edges, 2 * m, dense, v);
+    double remap_time = now_sec() - start;
+    DSU *dsu = dsu_new(distinct);
+    if (!dsu) return 1;
+    for (size_t e = 0; e < m; e++) {
+        dsu_union(dsu, dense[2 * e], dense[2 * e + 1]);
+    }
+    double dense_time = now_sec() - start;
+    size_t dense_sets = dsu_count(dsu);
+    dsu_free(dsu);
+
+    printf("edges=%zu distinct ids=%zu\n", m, hash_keys);
+    printf("hash-keyed DSU:     %.3f s  (sets=%zu)\n", hash_time, hash_sets);
+    printf("remap + dense DSU:  %.3f s  (remap %.3f s, sets=%zu)%s\n", dense_time, remap_time, dense_sets,
+           hash_sets == dense_sets && hash_keys == distinct ? "" : "  MISMATCH");
+
+    free(edges);
+    free(dense);
+    return 0;
+}
@@ -7,16 +7,7 @@
 #include <stdbool.h>
 #include <limits.h>
 
-/**
- * @brief Type definition for the comparison function.
- * returns > 0 if *a has higher priority than *b.
- * * @param a Pointer to the first element (e.g., &data[i]).
- * @param b Pointer to the second element.
- * @return int Positive if a has higher priority, 0 if equal, negative otherwise.
- */
-typedef int (*ComparisonFunction)(const void* a, const void* b);
-
-typedef struct Heap Heap;
+#include "Heap.h"
 
 /**
  * @brief Structure representing a generic-logic Heap.
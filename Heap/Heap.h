@@ -0,0 +1,51 @@
+/*
+ *  Binary heap of ints with a runtime comparison function (1-based array layout).
+ */
+
+#ifndef TEMPLATE_HEAP_H
+#define TEMPLATE_HEAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Type definition for the comparison function.
+ * returns > 0 if *a has higher priority than *b.
+ * * @param a Pointer to the first element (e.g., &data[i]).
+ * @param b Pointer to the second element.
+ * @return int Positive if a has higher priority, 0 if equal, negative otherwise.
+ */
+typedef int (*ComparisonFunction)(const void* a, const void* b);
+
+typedef struct Heap Heap;
+
+/**
+ * @brief Creates a new Heap instance.
+ * * @param max_capacity The maximum number of elements the heap can hold.
+ * @param comp The comparison function, returns > 0 if the first has higher priority than the second.
+ * @return Heap* A pointer to the newly created Heap structure, or NULL on failure.
+ */
+Heap *newHeap(size_t max_capacity, ComparisonFunction comp);
+/**
+ * @brief Frees all memory associated with the Heap.
+ * @param heap The heap structure to be freed.
+ */
+void freeHeap(Heap *heap);
+/**
+ * @brief Checks if the Heap is empty.
+ */
+bool isEmptyHeap(Heap *heap);
+/**
+ * @brief Retrieves the element with the highest priority (INT_MIN if the heap is empty).
+ */
+int topHeap(Heap *heap);
+/**
+ * @brief Inserts a new element into the Heap.
+ */
+void insertHeap(Heap *heap, int data);
+/**
+ * @brief Deletes the element with the highest priority (the root element).
+ */
+void deleteHeap(Heap *heap);
+
+#endif //TEMPLATE_HEAP_H
@@ -0,0 +1,155 @@
+/*
+ *  d-ary heap generated per element type and order, so the comparison inlines.
+ *
+ *  DARY_HEAP_DEFINE(Name, Type, HIGHER, D) defines the struct 'Name' and
+ *  static inline functions Name_init, Name_destroy, Name_push, Name_pop,
+ *  Name_replace_top, Name_top and Name_size. HIGHER(a, b) is an expression
+ *  that is true when a has higher priority than b (a < b for a min-heap), and
+ *  D is the arity.
+ *
+ *  The array is 0-based: the children of i are D*i+1 .. D*i+D. The data
+ *  pointer is offset by D-1 elements inside a 64-byte aligned block, so every
+ *  sibling group starts on a multiple of D elements; with D = 4 and 4- to
+ *  16-byte elements, the siblings compared at each level share one cache line.
+ *  Sifts move a hole instead of swapping: the moving element is written once,
+ *  at its final position.
+ *
+ *  Heaps that keep their own array (e.g. indexed heaps, which must record
+ *  where every element moves) use DARY_HEAP_DEFINE_SIFT(Name, Type, HIGHER, D,
+ *  MOVED) alone. It defines only Name_sift_up and Name_sift_down over a plain
+ *  array; MOVED(context, element, index) runs after each element is written
+ *  to data[index], with the 'context' pointer passed to the sift.
+ */
+
+#ifndef TEMPLATE_DARY_HEAP_H
+#define TEMPLATE_DARY_HEAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define DARY_HEAP_LESS(a, b) ((a) < (b))
+#define DARY_HEAP_GREATER(a, b) ((a) > (b))
+#define DARY_HEAP_NO_HOOK(context, element, index) ((void)(context))
+
+#define DARY_HEAP_DEFINE_SIFT(Name, Type, HIGHER, D, MOVED)                                        \
+/* Moves 'value' up from the hole at index i. */                                                   \
+static inline void Name##_sift_up(Type *data, size_t i, Type value, void *context) {               \
+    while (i > 0) {                                                                                \
+        size_t parent = (i - 1) / (D);                                                             \
+        if (!(HIGHER(value, data[parent]))) break;                                                 \
+        data[i] = data[parent];                                                                    \
+        MOVED(context, data[i], i);                                                                \
+        i = parent;                                                                                \
+    }                                                                                              \
+    data[i] = value;                                                                               \
+    MOVED(context, data[i], i);                                                                    \
+}                                                                                                  \
+                                                                                                   \
+/* Moves 'value' down from the hole at index i of the n-element heap data[0..n). */                \
+static inline void Name##_sift_down(Type *data, size_t n, size_t i, Type value, void *context) {   \
+    for (;;) {                                                                                     \
+        size_t first = (D) * i + 1;                                                                \
+        if (first >= n) break;                                                                     \
+        size_t best = first;                                                                       \
+        Type best_value = data[first];                                                             \
+        if (first + (D) <= n) {                                                                    \
+            /* Full sibling group: a fixed trip count that unrolls into conditional moves. */      \
+            /* The grandchildren may lie past the end, so their address is formed as an integer. */\
+            uintptr_t grandchildren = (uintptr_t)data + ((D) * first + 1) * sizeof(Type);          \
+            __builtin_prefetch((const void *)grandchildren);                                       \
+            __builtin_prefetch((const void *)(grandchildren + 64));                                \
+            for (size_t c = first + 1; c < first + (D); c++) {                                     \
+                Type candidate = data[c];                                                          \
+                int higher = HIGHER(candidate, best_value);                                        \
+                best = higher ? c : best;                                                          \
+                best_value = higher ? candidate : best_value;                                      \
+            }                                                                                      \
+        } else {                                                                                   \
+            for (size_t c = first + 1; c < n; c++) {                                               \
+                if (HIGHER(data[c], best_value)) {                                                 \
+                    best = c;                                                                      \
+                    best_value = data[c];                                                          \
+                }                                                                                  \
+            }                                                                                      \
+        }                                                                                          \
+        if (!(HIGHER(best_value, value))) break;                                                   \
+        data[i] = best_value;                                                                      \
+        MOVED(context, data[i], i);                                                                \
+        i = best;                                                                                  \
+    }                                                                                              \
+    data[i] = value;                                                                               \
+    MOVED(context, data[i], i);                                                                    \
+}
+
+#define DARY_HEAP_DEFINE(Name, Type, HIGHER, D)                                                    \
+DARY_HEAP_DEFINE_SIFT(Name, Type, HIGHER, D, DARY_HEAP_NO_HOOK)                                    \
+                                                                                                   \
+typedef struct {                                                                                   \
+    Type *data;                                                                                    \
+    void *block;                                                                                   \
+    size_t size;                                                                                   \
+    size_t capacity;                                                                               \
+} Name;                                                                                            \
+                                                                                                   \
+/* Returns 0 on success, -1 on allocation failure. */                                              \
+static inline int Name##_init(Name *heap, size_t capacity) {                                       \
+    size_t bytes = sizeof(Type) * (capacity + (D) - 1);                                            \
+    heap->block = aligned_alloc(64, (bytes + 63) / 64 * 64);                                       \
+    if (!heap->block) {                                                                            \
+        fprintf(stderr, #Name " allocation failed!\n");                                            \
+        return -1;                                                                                 \
+    }                                                                                              \
+    heap->data = (Type *)heap->block + (D) - 1;                                                    \
+    heap->size = 0;                                                                                \
+    heap->capacity = capacity;                                                                     \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline void Name##_destroy(Name *heap) {                                                    \
+    free(heap->block);                                                                             \
+    heap->block = NULL;                                                                            \
+    heap->data = NULL;                                                                             \
+    heap->size = heap->capacity = 0;                                                               \
+}                                                                                                  \
+                                                                                                   \
+static inline size_t Name##_size(const Name *heap) {                                               \
+    return heap->size;                                                                             \
+}                                                                                                  \
+                                                                                                   \
+/* The heap must not be empty. */                                                                  \
+static inline Type Name##_top(const Name *heap) {                                                  \
+    return heap->data[0];                                                                          \
+}                                                                                                  \
+                                                                                                   \
+/* Returns 0 on success, -1 if the heap is full. */                                                \
+static inline int Name##_push(Name *heap, Type value) {                                            \
+    if (heap->size >= heap->capacity) {                                                            \
+        fprintf(stderr, "Error: Heap is full!\n");                                                 \
+        return -1;                                                                                 \
+    }                                                                                              \
+    Name##_sift_up(heap->data, heap->size++, value, NULL);                                         \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+/* Removes the top element into *out (may be NULL). Returns 0, or -1 if the heap is empty. */      \
+static inline int Name##_pop(Name *heap, Type *out) {                                              \
+    if (heap->size == 0) {                                                                         \
+        return -1;                                                                                 \
+    }                                                                                              \
+    if (out) *out = heap->data[0];                                                                 \
+    size_t n = --heap->size;                                                                       \
+    Name##_sift_down(heap->data, n, 0, heap->data[n], NULL);                                       \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+/* Pop plus push in a single sift; the heap must not be empty. */                                  \
+static inline void Name##_replace_top(Name *heap, Type value) {                                    \
+    Name##_sift_down(heap->data, heap->size, 0, value, NULL);                                      \
+}
+
+DARY_HEAP_DEFINE(IntMinHeap4, int, DARY_HEAP_LESS, 4)
+DARY_HEAP_DEFINE(IntMaxHeap4, int, DARY_HEAP_GREATER, 4)
+
+#endif //TEMPLATE_DARY_HEAP_H
@@ -0,0 +1,95 @@
+/*
+ *  Benchmark: 4-ary inlined heap against the binary function-pointer Heap on pop-heavy workloads.
+ *  Usage: dary-heap-bench [num_elements] [hold_operations]
+ *         (default: 10M elements, 10M pop+push operations)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "Heap.h"
+#include "dary_heap.h"
+#include "../bench_util.h"
+
+static int min_comp(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x < y) - (x > y);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    size_t holds = argc > 2 ? strtoull(argv[2], NULL, 10) : 10000000;
+
+    int *values = malloc(sizeof(int) * n);
+    Heap *binary = newHeap(n, min_comp);
+    IntMinHeap4 dary;
+    if (!values || !binary || IntMinHeap4_init(&dary, n) != 0) {
+        fprintf(stderr, "Allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 5;
+    for (size_t i = 0; i < n; i++) {
+        values[i] = (int)(next_rand(&state) >> 34);
+    }
+
+    // Hold model: pop the minimum and push a slightly larger key, as an event queue does.
+    uint64_t binary_sum = 0, dary_sum = 0;
+    double start = now_sec();
+    for (size_t i = 0; i < n; i++) {
+        insertHeap(binary, values[i]);
+    }
+    double binary_push = now_sec() - start;
+    state = 7;
+    start = now_sec();
+    for (size_t i = 0; i < holds; i++) {
+        int top = topHeap(binary);
+        deleteHeap(binary);
+        insertHeap(binary, top + (int)(next_rand(&state) & 1023));
+        binary_sum += (uint64_t)top;
+    }
+    double binary_hold = now_sec() - start;
+    start = now_sec();
+    while (!isEmptyHeap(binary)) {
+        binary_sum = binary_sum * 31 + (uint64_t)topHeap(binary);
+        deleteHeap(binary);
+    }
+    double binary_pop = now_sec() - start;
+
+    start = now_sec();
+    for (size_t i = 0; i < n; i++) {
+        IntMinHeap4_push(&dary, values[i]);
+    }
+    double dary_push = now_sec() - start;
+    state = 7;
+    start = now_sec();
+    for (size_t i = 0; i < holds; i++) {
+        int top = 0;
+        IntMinHeap4_pop(&dary, &top);
+        IntMinHeap4_push(&dary, top + (int)(next_rand(&state) & 1023));
+        dary_sum += (uint64_t)top;
+    }
+    double dary_hold = now_sec() - start;
+    start = now_sec();
+    int top = 0;
+    while (IntMinHeap4_pop(&dary, &top) == 0) {
+        dary_sum = dary_sum * 31 + (uint64_t)top;
+    }
+    double dary_pop = now_sec() - start;
+
+    printf("n=%zu\n", n);
+    printf("  push all     binary %7.3f s  4-ary %7.3f s  -> %.2fx\n", binary_push, dary_push,
+           binary_push / dary_push);
+    printf("  pop+push     binary %7.3f s  4-ary %7.3f s  -> %.2fx  (%zu ops)\n", binary_hold, dary_hold,
+           binary_hold / dary_hold, holds);
+    printf("  pop all      binary %7.3f s  4-ary %7.3f s  -> %.2fx%s\n", binary_pop, dary_pop,
+           binary_pop / dary_pop, binary_sum != dary_sum ? "  MISMATCH" : "");
+
+    freeHeap(binary);
+    IntMinHeap4_destroy(&dary);
+    free(values);
+    return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ *  Growable 4-ary heap of fixed-size elements stored inline.
+ *
+ *  Elements live back to back in one byte array (no per-element allocation or
+ *  pointer), 0-based, with the children of i at 4i+1 .. 4i+4. Sifts keep the
+ *  moving element in a scratch slot and copy each displaced element once.
+ *  The array doubles when full.
+ *
+ *  This is the one heap that does not use the sifts from dary_heap.h: those
+ *  are generated for a Type known at compile time and move elements by
+ *  assignment, while here the element size is a run-time value and every move
+ *  is a memcpy of elem_size bytes through the comparison function pointer.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "generic_heap.h"
+
+#define GENERIC_HEAP_ARITY 4
+#define GENERIC_HEAP_INITIAL_CAPACITY 16
+
+struct GenericHeap {
+    char *data;
+    size_t size;
+    size_t capacity;
+    size_t elem_size;
+    ComparisonFunction comp;
+    char *scratch;           ///< Holds the element being sifted (elem_size bytes).
+};
+
+static inline char *element(const GenericHeap *heap, size_t i) {
+    return heap->data + i * heap->elem_size;
+}
+
+/**
+ * @brief Copies one element; the common sizes get a fixed-size memcpy that compiles to plain moves.
+ */
+static inline void copy_element(const GenericHeap *heap, void *dst, const void *src) {
+    switch (heap->elem_size) {
+        case 4: memcpy(dst, src, 4); break;
+        case 8: memcpy(dst, src, 8); break;
+        case 16: memcpy(dst, src, 16); break;
+        case 32: memcpy(dst, src, 32); break;
+        default: memcpy(dst, src, heap->elem_size); break;
+    }
+}
+
+/**
+ * @brief Moves the element in heap->scratch up from hole 'i' and stores it.
+ */
+static void sift_up(GenericHeap *heap, size_t i) {
+    while (i > 0) {
+        size_t parent = (i - 1) / GENERIC_HEAP_ARITY;
+        if (heap->comp(heap->scratch, element(heap, parent)) <= 0) {
+            break;
+        }
+        copy_element(heap, element(heap, i), element(heap, parent));
+        i = parent;
+    }
+    copy_element(heap, element(heap, i), heap->scratch);
+}
+
+/**
+ * @brief Moves the element in heap->scratch down from hole 'i' and stores it.
+ */
+static void sift_down(GenericHeap *heap, size_t i) {
+    size_t n = heap->size;
+    for (;;) {
+        size_t first = GENERIC_HEAP_ARITY * i + 1;
+        if (first >= n) {
+            break;
+        }
+        size_t last = first + GENERIC_HEAP_ARITY < n ? first + GENERIC_HEAP_ARITY : n;
+        if (GENERIC_HEAP_ARITY * first + 1 < n) {
+            __builtin_prefetch(element(heap, GENERIC_HEAP_ARITY * first + 1));
+        }
+        size_t best = first;
+        for (size_t c = first + 1; c < last; c++) {
+            if (heap->comp(element(heap, c), element(heap, best)) > 0) {
+                best = c;
+            }
+        }
+        if (heap->comp(element(heap, best), heap->scratch) <= 0) {
+            break;
+        }
+        copy_element(heap, element(heap, i), element(heap, best));
+        i = best;
+    }
+    copy_element(heap, element(heap, i), heap->scratch);
+}
+
+/**
+ * @brief Grows the array to hold at least 'needed' elements.
+ * @return int 0 on success, -1 on allocation failure.
+ */
+static int reserve(GenericHeap *heap, size_t needed) {
+    if (needed <= heap->capacity) {
+        return 0;
+    }
+    size_t capacity = heap->capacity ? heap->capacity : GENERIC_HEAP_INITIAL_CAPACITY;
+    while (capacity < needed) {
+        // Stop before the doubled capacity, or its size in bytes, overflows.
+        if (capacity > SIZE_MAX / 2 / heap->elem_size) {
+            fprintf(stderr, "GenericHeap allocation failed!\n");
+            return -1;
+        }
+        capacity *= 2;
+    }
+    char *data = realloc(heap->data, capacity * heap->elem_size);
+    if (!data) {
+        fprintf(stderr, "GenericHeap allocation failed!\n");
+        return -1;
+    }
+    heap->data = data;
+    heap->capacity = capacity;
+    return 0;
+}
+
+GenericHeap *heap_new(size_t elem_size, ComparisonFunction comp) {
+    if (elem_size == 0 || !comp) {
+        fprintf(stderr, "GenericHeap needs a non-zero element size and a comparison function!\n");
+        return NULL;
+    }
+    GenericHeap *heap = malloc(sizeof(GenericHeap));
+    if (!heap) {
+        fprintf(stderr, "GenericHeap allocation failed!\n");
+        return NULL;
+    }
+    heap->data = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+    heap->elem_size = elem_size;
+    heap->comp = comp;
+    heap->scratch = malloc(elem_size);
+    if (!heap->scratch || reserve(heap, GENERIC_HEAP_INITIAL_CAPACITY) != 0) {
+        fprintf(stderr, "GenericHeap allocation failed!\n");
+        heap_free(heap);
+        return NULL;
+    }
+    return heap;
+}
+
+GenericHeap *heap_build(const void *array, size_t n, size_t elem_size, ComparisonFunction comp) {
+    GenericHeap *heap = heap_new(elem_size, comp);
+    if (!heap || reserve(heap, n) != 0) {
+        heap_free(heap);
+        return NULL;
+    }
+    if (n > 0) {
+        memcpy(heap->data, array, n * elem_size);
+    }
+    heap->size = n;
+
+    // Floyd: sift down every internal node, last first; the total work is O(n).
+    for (size_t i = n > 1 ? (n - 2) / GENERIC_HEAP_ARITY + 1 : 0; i-- > 0;) {
+        copy_element(heap, heap->scratch, element(heap, i));
+        sift_down(heap, i);
+    }
+    return heap;
+}
+
+void heap_free(GenericHeap *heap) {
+    if (heap) {
+        free(heap->data);
+        free(heap->scratch);
+        free(heap);
+    }
+}
+
+int heap_push(GenericHeap *heap, const void *elem) {
+    if (reserve(heap, heap->size + 1) != 0) {
+        return -1;
+    }
+    copy_element(heap, heap->scratch, elem);
+    sift_up(heap, heap->size++);
+    return 0;
+}
+
+int heap_pop(GenericHeap *heap, void *out) {
+    if (heap->size == 0) {
+        return -1;
+    }
+    if (out) {
+        copy_element(heap, out, element(heap, 0));
+    }
+    heap->size--;
+    if (heap->size > 0) {
+        copy_element(heap, heap->scratch, element(heap, heap->size));
+        sift_down(heap, 0);
+    }
+    return 0;
+}
+
+const void *heap_top(const GenericHeap *heap) {
+    return heap->size > 0 ? element(heap, 0) : NULL;
+}
+
+size_t heap_size(const GenericHeap *heap) {
+    return heap->size;
+}
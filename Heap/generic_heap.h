@@ -0,0 +1,52 @@
+/*
+ *  Growable heap of fixed-size elements of any type, stored inline in one array.
+ */
+
+#ifndef TEMPLATE_GENERIC_HEAP_H
+#define TEMPLATE_GENERIC_HEAP_H
+
+#include <stddef.h>
+
+#include "Heap.h"
+
+typedef struct GenericHeap GenericHeap;
+
+/**
+ * @brief Creates an empty heap of 'elem_size'-byte elements.
+ * @param elem_size The size of one element in bytes (e.g. sizeof(struct Job)).
+ * @param comp The comparison function, returns > 0 if the first has higher priority than the second.
+ * @return GenericHeap* The new heap, or NULL on failure.
+ */
+GenericHeap *heap_new(size_t elem_size, ComparisonFunction comp);
+/**
+ * @brief Creates a heap holding a copy of array[0..n) in O(n) (Floyd's bottom-up heapify).
+ * @param array The elements, 'elem_size' bytes each.
+ * @return GenericHeap* The new heap, or NULL on failure.
+ */
+GenericHeap *heap_build(const void *array, size_t n, size_t elem_size, ComparisonFunction comp);
+/**
+ * @brief Frees all memory associated with the heap.
+ */
+void heap_free(GenericHeap *heap);
+/**
+ * @brief Copies 'elem' into the heap, doubling the array when it is full.
+ * @return int 0 on success, -1 on allocation failure.
+ */
+int heap_push(GenericHeap *heap, const void *elem);
+/**
+ * @brief Removes the element with the highest priority.
+ * @param out Receives a copy of the removed element (may be NULL).
+ * @return int 0 on success, -1 if the heap is empty.
+ */
+int heap_pop(GenericHeap *heap, void *out);
+/**
+ * @brief Returns a pointer to the element with the highest priority, or NULL if the heap is empty.
+ * * The pointer is valid until the next push or pop.
+ */
+const void *heap_top(const GenericHeap *heap);
+/**
+ * @brief Returns the number of elements in the heap.
+ */
+size_t heap_size(const GenericHeap *heap);
+
+#endif //TEMPLATE_GENERIC_HEAP_H
@@ -0,0 +1,78 @@
+/*
+ *  Benchmark: GenericHeap of (priority, payload) structs, heap_build against n heap_push calls.
+ *  Usage: generic-heap-bench [num_elements]
+ *         (default: 10M elements)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "generic_heap.h"
+#include "../bench_util.h"
+
+typedef struct {
+    double priority;
+    uint64_t payload;
+} Task;
+
+static int task_min_comp(const void *a, const void *b) {
+    double x = ((const Task *)a)->priority;
+    double y = ((const Task *)b)->priority;
+    return (x < y) - (x > y);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+
+    Task *tasks = malloc(sizeof(Task) * (n > 0 ? n : 1));
+    if (!tasks) {
+        fprintf(stderr, "Allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 3;
+    for (size_t i = 0; i < n; i++) {
+        tasks[i] = (Task){(double)(next_rand(&state) >> 11) * 0x1.0p-53, i};
+    }
+
+    double start = now_sec();
+    GenericHeap *pushed = heap_new(sizeof(Task), task_min_comp);
+    if (!pushed) {
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        heap_push(pushed, &tasks[i]);
+    }
+    double push_time = now_sec() - start;
+
+    start = now_sec();
+    GenericHeap *built = heap_build(tasks, n, sizeof(Task), task_min_comp);
+    if (!built) {
+        return 1;
+    }
+    double build_time = now_sec() - start;
+
+    // Both heaps must yield the same priorities in non-decreasing order.
+    size_t out_of_order = 0;
+    double previous = -1;
+    start = now_sec();
+    Task a, b;
+    while (heap_pop(pushed, &a) == 0 && heap_pop(built, &b) == 0) {
+        out_of_order += a.priority != b.priority || a.priority < previous;
+        previous = a.priority;
+    }
+    double pop_time = now_sec() - start;
+
+    printf("n=%zu  (%zu-byte elements)\n", n, sizeof(Task));
+    printf("  %zu x heap_push  %7.3f s\n", n, push_time);
+    printf("  heap_build       %7.3f s  -> %.2fx\n", build_time, push_time / build_time);
+    printf("  pop both         %7.3f s%s\n", pop_time,
+           out_of_order || heap_size(pushed) || heap_size(built) ? "  MISMATCH" : "");
+
+    heap_free(pushed);
+    heap_free(built);
+    free(tasks);
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ *  Indexed 4-ary min-heap.
+ *
+ *  The heap is a flat array of (key, id) entries, 0-based, with the children of
+ *  i at 4i+1 .. 4i+4; storing the key in the entry means sifts never touch a
+ *  separate key array. pos[id] is the index of 'id' in the array, or
+ *  IHEAP_ABSENT. The sifts come from dary_heap.h with a hook that updates
+ *  pos[] on every write of an entry, so that any ID can be found, re-keyed or
+ *  removed in O(log n).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "indexed_heap.h"
+#include "dary_heap.h"
+
+#define IHEAP_D 4
+#define IHEAP_ABSENT (-1)
+
+typedef struct {
+    long long key;
+    int id;
+} IndexedEntry;
+
+struct IndexedHeap {
+    IndexedEntry *entries;
+    int *pos;
+    int size;
+    int capacity;   ///< Number of IDs; the heap never holds more entries than that.
+};
+
+#define IHEAP_KEY_LOWER(a, b) ((a).key < (b).key)
+#define IHEAP_POS_MOVED(pos, entry, index) (((int *)(pos))[(entry).id] = (int)(index))
+
+DARY_HEAP_DEFINE_SIFT(IndexedSift, IndexedEntry, IHEAP_KEY_LOWER, IHEAP_D, IHEAP_POS_MOVED)
+
+static inline void sift_up(IndexedHeap *heap, int i, IndexedEntry entry) {
+    IndexedSift_sift_up(heap->entries, (size_t)i, entry, heap->pos);
+}
+
+static inline void sift_down(IndexedHeap *heap, int i, IndexedEntry entry) {
+    IndexedSift_sift_down(heap->entries, (size_t)heap->size, (size_t)i, entry, heap->pos);
+}
+
+/**
+ * @brief Takes the entry at index i out of the heap and fills the hole with the last entry.
+ */
+static void remove_at(IndexedHeap *heap, int i) {
+    heap->pos[heap->entries[i].id] = IHEAP_ABSENT;
+    heap->size--;
+    if (i == heap->size) {
+        return;
+    }
+    IndexedEntry last = heap->entries[heap->size];
+    if (i > 0 && last.key < heap->entries[(i - 1) / IHEAP_D].key) {
+        sift_up(heap, i, last);
+    } else {
+        sift_down(heap, i, last);
+    }
+}
+
+IndexedHeap *iheap_new(int n) {
+    if (n <= 0) {
+        fprintf(stderr, "IndexedHeap size must be greater than 0!\n");
+        return NULL;
+    }
+    IndexedHeap *heap = malloc(sizeof(IndexedHeap));
+    if (!heap) {
+        fprintf(stderr, "IndexedHeap allocation failed!\n");
+        return NULL;
+    }
+    heap->entries = malloc(sizeof(IndexedEntry) * n);
+    heap->pos = malloc(sizeof(int) * n);
+    if (!heap->entries || !heap->pos) {
+        fprintf(stderr, "IndexedHeap allocation failed!\n");
+        iheap_free(heap);
+        return NULL;
+    }
+    for (int id = 0; id < n; id++) {
+        heap->pos[id] = IHEAP_ABSENT;
+    }
+    heap->size = 0;
+    heap->capacity = n;
+    return heap;
+}
+
+void iheap_free(IndexedHeap *heap) {
+    if (heap) {
+        free(heap->entries);
+        free(heap->pos);
+        free(heap);
+    }
+}
+
+bool iheap_contains(const IndexedHeap *heap, int id) {
+    return id >= 0 && id < heap->capacity && heap->pos[id] != IHEAP_ABSENT;
+}
+
+int iheap_push(IndexedHeap *heap, int id, long long key) {
+    if (id < 0 || id >= heap->capacity || heap->pos[id] != IHEAP_ABSENT) {
+        return -1;
+    }
+    sift_up(heap, heap->size++, (IndexedEntry){key, id});
+    return 0;
+}
+
+int iheap_top(const IndexedHeap *heap, int *id, long long *key) {
+    if (heap->size == 0) {
+        return -1;
+    }
+    if (id) *id = heap->entries[0].id;
+    if (key) *key = heap->entries[0].key;
+    return 0;
+}
+
+int iheap_pop(IndexedHeap *heap, int *id, long long *key) {
+    if (iheap_top(heap, id, key) != 0) {
+        return -1;
+    }
+    remove_at(heap, 0);
+    return 0;
+}
+
+int iheap_decrease_key(IndexedHeap *heap, int id, long long key) {
+    if (!iheap_contains(heap, id) || key > heap->entries[heap->pos[id]].key) {
+        return -1;
+    }
+    sift_up(heap, heap->pos[id], (IndexedEntry){key, id});
+    return 0;
+}
+
+int iheap_increase_key(IndexedHeap *heap, int id, long long key) {
+    if (!iheap_contains(heap, id) || key < heap->entries[heap->pos[id]].key) {
+        return -1;
+    }
+    sift_down(heap, heap->pos[id], (IndexedEntry){key, id});
+    return 0;
+}
+
+int iheap_remove(IndexedHeap *heap, int id) {
+    if (!iheap_contains(heap, id)) {
+        return -1;
+    }
+    remove_at(heap, heap->pos[id]);
+    return 0;
+}
+
+long long iheap_key(const IndexedHeap *heap, int id) {
+    return heap->entries[heap->pos[id]].key;
+}
+
+int iheap_size(const IndexedHeap *heap) {
+    return heap->size;
+}
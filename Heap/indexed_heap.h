@@ -0,0 +1,67 @@
+/*
+ *  Indexed min-heap over element IDs 0..n-1 with decrease-key, increase-key and removal.
+ */
+
+#ifndef TEMPLATE_INDEXED_HEAP_H
+#define TEMPLATE_INDEXED_HEAP_H
+
+#include <stdbool.h>
+
+typedef struct IndexedHeap IndexedHeap;
+
+/**
+ * @brief Creates an empty heap for the IDs 0..n-1.
+ * @param n The number of IDs (greater than 0).
+ * @return IndexedHeap* The new heap, or NULL on failure.
+ */
+IndexedHeap *iheap_new(int n);
+/**
+ * @brief Frees all memory associated with the heap.
+ */
+void iheap_free(IndexedHeap *heap);
+/**
+ * @brief Inserts 'id' with priority 'key' (smaller keys come first), O(log n).
+ * @return int 0 on success, -1 if the id is out of range or already in the heap.
+ */
+int iheap_push(IndexedHeap *heap, int id, long long key);
+/**
+ * @brief Removes the ID with the smallest key, O(log n).
+ * @param id Receives the removed ID (may be NULL).
+ * @param key Receives its key (may be NULL).
+ * @return int 0 on success, -1 if the heap is empty.
+ */
+int iheap_pop(IndexedHeap *heap, int *id, long long *key);
+/**
+ * @brief Reads the ID with the smallest key without removing it.
+ * @return int 0 on success, -1 if the heap is empty.
+ */
+int iheap_top(const IndexedHeap *heap, int *id, long long *key);
+/**
+ * @brief Lowers the key of 'id' to 'key', O(log n).
+ * @return int 0 on success, -1 if the id is not in the heap or 'key' is larger than its key.
+ */
+int iheap_decrease_key(IndexedHeap *heap, int id, long long key);
+/**
+ * @brief Raises the key of 'id' to 'key', O(log n).
+ * @return int 0 on success, -1 if the id is not in the heap or 'key' is smaller than its key.
+ */
+int iheap_increase_key(IndexedHeap *heap, int id, long long key);
+/**
+ * @brief Removes 'id' from the heap, O(log n).
+ * @return int 0 on success, -1 if the id is not in the heap.
+ */
+int iheap_remove(IndexedHeap *heap, int id);
+/**
+ * @brief Checks whether 'id' is in the heap, O(1).
+ */
+bool iheap_contains(const IndexedHeap *heap, int id);
+/**
+ * @brief Returns the key of 'id', which must be in the heap.
+ */
+long long iheap_key(const IndexedHeap *heap, int id);
+/**
+ * @brief Returns the number of IDs in the heap.
+ */
+int iheap_size(const IndexedHeap *heap);
+
+#endif //TEMPLATE_INDEXED_HEAP_H
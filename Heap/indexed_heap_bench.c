@@ -0,0 +1,121 @@
+/*
+ *  Benchmark: Dijkstra with IndexedHeap decrease-key against pushing duplicates into a GenericHeap.
+ *  Usage: indexed-heap-bench [num_vertices] [average_degree]
+ *         (default: 1M vertices, degree 16)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "generic_heap.h"
+#include "indexed_heap.h"
+#include "../bench_util.h"
+
+typedef struct {
+    long long distance;
+    int vertex;
+} LazyEntry;
+
+static int lazy_min_comp(const void *a, const void *b) {
+    long long x = ((const LazyEntry *)a)->distance;
+    long long y = ((const LazyEntry *)b)->distance;
+    return (x < y) - (x > y);
+}
+
+int main(int argc, char *argv[]) {
+    int num_vertices = argc > 1 ? atoi(argv[1]) : 1000000;
+    int degree = argc > 2 ? atoi(argv[2]) : 16;
+    if (num_vertices < 1) num_vertices = 1;
+    size_t num_arcs = (size_t)num_vertices * degree;
+
+    // Random directed graph in CSR form: 'degree' out-arcs per vertex.
+    size_t *offsets = malloc(sizeof(size_t) * ((size_t)num_vertices + 1));
+    int *targets = malloc(sizeof(int) * (num_arcs > 0 ? num_arcs : 1));
+    int *weights = malloc(sizeof(int) * (num_arcs > 0 ? num_arcs : 1));
+    long long *indexed_distance = malloc(sizeof(long long) * num_vertices);
+    long long *lazy_distance = malloc(sizeof(long long) * num_vertices);
+    IndexedHeap *indexed = iheap_new(num_vertices);
+    GenericHeap *lazy = heap_new(sizeof(LazyEntry), lazy_min_comp);
+    if (!offsets || !targets || !weights || !indexed_distance || !lazy_distance || !indexed || !lazy) {
+        fprintf(stderr, "Allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 17;
+    for (int u = 0; u <= num_vertices; u++) {
+        offsets[u] = (size_t)u * degree;
+    }
+    for (size_t a = 0; a < num_arcs; a++) {
+        targets[a] = (int)(next_rand(&state) % (uint64_t)num_vertices);
+        weights[a] = (int)(next_rand(&state) % 1000000);
+    }
+
+    double start = now_sec();
+    for (int v = 0; v < num_vertices; v++) {
+        indexed_distance[v] = -1;
+    }
+    size_t decreases = 0;
+    iheap_push(indexed, 0, 0);
+    int u;
+    long long d;
+    while (iheap_pop(indexed, &u, &d) == 0) {
+        indexed_distance[u] = d;
+        for (size_t a = offsets[u]; a < offsets[u + 1]; a++) {
+            int v = targets[a];
+            long long candidate = d + weights[a];
+            if (indexed_distance[v] >= 0) {
+                continue;
+            }
+            if (!iheap_contains(indexed, v)) {
+                iheap_push(indexed, v, candidate);
+            } else if (candidate < iheap_key(indexed, v)) {
+                iheap_decrease_key(indexed, v, candidate);
+                decreases++;
+            }
+        }
+    }
+    double indexed_time = now_sec() - start;
+
+    start = now_sec();
+    for (int v = 0; v < num_vertices; v++) {
+        lazy_distance[v] = -1;
+    }
+    size_t pushes = 1, stale = 0;
+    heap_push(lazy, &(LazyEntry){0, 0});
+    LazyEntry entry;
+    while (heap_pop(lazy, &entry) == 0) {
+        if (lazy_distance[entry.vertex] >= 0) {
+            stale++;
+            continue;
+        }
+        lazy_distance[entry.vertex] = entry.distance;
+        for (size_t a = offsets[entry.vertex]; a < offsets[entry.vertex + 1]; a++) {
+            int v = targets[a];
+            if (lazy_distance[v] < 0) {
+                heap_push(lazy, &(LazyEntry){entry.distance + weights[a], v});
+                pushes++;
+            }
+        }
+    }
+    double lazy_time = now_sec() - start;
+
+    size_t mismatches = 0;
+    for (int v = 0; v < num_vertices; v++) {
+        mismatches += indexed_distance[v] != lazy_distance[v];
+    }
+    printf("V=%d  arcs=%zu\n", num_vertices, num_arcs);
+    printf("  indexed decrease-key  %7.3f s  (%zu decreases, heap <= V entries)\n", indexed_time, decreases);
+    printf("  lazy duplicates       %7.3f s  (%zu pushes, %zu stale pops)  -> %.2fx%s\n", lazy_time, pushes,
+           stale, lazy_time / indexed_time, mismatches ? "  MISMATCH" : "");
+
+    iheap_free(indexed);
+    heap_free(lazy);
+    free(offsets);
+    free(targets);
+    free(weights);
+    free(indexed_distance);
+    free(lazy_distance);
+    return 0;
+}
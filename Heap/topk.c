@@ -0,0 +1,124 @@
+/*
+ *  Bounded top-k selection with a size-k min-heap.
+ *
+ *  The root of the heap is the lowest of the k kept scores, i.e. the threshold
+ *  a new element must beat. Almost every element of a long stream is rejected
+ *  by that one comparison, so topk_push_batch compares four scores at a time
+ *  against the broadcast threshold (AVX2) and only walks the set bits of the
+ *  comparison mask; the threshold is reloaded after each accepted element.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "topk.h"
+#include "dary_heap.h"
+
+#define TOPK_SCORE_LOWER(a, b) ((a).score < (b).score)
+
+DARY_HEAP_DEFINE(TopKHeap, TopKEntry, TOPK_SCORE_LOWER, 4)
+
+struct TopK {
+    TopKHeap heap;     ///< Min-heap on score, with capacity k.
+    int k;
+};
+
+TopK *topk_new(int k) {
+    if (k <= 0) {
+        fprintf(stderr, "TopK size must be greater than 0!\n");
+        return NULL;
+    }
+    TopK *topk = malloc(sizeof(TopK));
+    if (!topk) {
+        fprintf(stderr, "TopK allocation failed!\n");
+        return NULL;
+    }
+    if (TopKHeap_init(&topk->heap, (size_t)k) != 0) {
+        free(topk);
+        return NULL;
+    }
+    topk->k = k;
+    return topk;
+}
+
+void topk_free(TopK *topk) {
+    if (topk) {
+        TopKHeap_destroy(&topk->heap);
+        free(topk);
+    }
+}
+
+void topk_push(TopK *topk, double score, int64_t id) {
+    if (isnan(score)) {
+        return;
+    }
+    if (TopKHeap_size(&topk->heap) < (size_t)topk->k) {
+        TopKHeap_push(&topk->heap, (TopKEntry){score, id});
+    } else if (score > TopKHeap_top(&topk->heap).score) {
+        // Replace the lowest kept score: one sift down instead of a pop plus a push.
+        TopKHeap_replace_top(&topk->heap, (TopKEntry){score, id});
+    }
+}
+
+void topk_push_batch(TopK *topk, const double scores[], const int64_t ids[], size_t n) {
+    size_t i = 0;
+    // Until the heap is full every element is kept, so there is nothing to filter.
+    for (; i < n && TopKHeap_size(&topk->heap) < (size_t)topk->k; i++) {
+        topk_push(topk, scores[i], ids ? ids[i] : (int64_t)i);
+    }
+    if (TopKHeap_size(&topk->heap) < (size_t)topk->k) {
+        return; // the batch ran out first, so there is no threshold yet
+    }
+#if defined(__AVX2__)
+    __m256d threshold = _mm256_set1_pd(TopKHeap_top(&topk->heap).score);
+    for (; i + 4 <= n; i += 4) {
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(&scores[i]), threshold, _CMP_GT_OQ));
+        if (mask) {
+            while (mask) {
+                size_t j = i + (size_t)__builtin_ctz((unsigned int)mask);
+                topk_push(topk, scores[j], ids ? ids[j] : (int64_t)j);
+                mask &= mask - 1;
+            }
+            threshold = _mm256_set1_pd(TopKHeap_top(&topk->heap).score);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (scores[i] > TopKHeap_top(&topk->heap).score) {
+            topk_push(topk, scores[i], ids ? ids[i] : (int64_t)i);
+        }
+    }
+}
+
+void topk_merge(TopK *dst, const TopK *src) {
+    for (size_t i = 0; i < src->heap.size; i++) {
+        topk_push(dst, src->heap.data[i].score, src->heap.data[i].id);
+    }
+}
+
+double topk_threshold(const TopK *topk) {
+    return TopKHeap_size(&topk->heap) < (size_t)topk->k ? -INFINITY : TopKHeap_top(&topk->heap).score;
+}
+
+int topk_size(const TopK *topk) {
+    return (int)TopKHeap_size(&topk->heap);
+}
+
+int topk_results(const TopK *topk, TopKEntry out[]) {
+    // Heapsort a copy: repeatedly moving the minimum to the back leaves out[] in descending order.
+    size_t size = TopKHeap_size(&topk->heap);
+    for (size_t i = 0; i < size; i++) {
+        out[i] = topk->heap.data[i];
+    }
+    for (size_t n = size; n > 1; n--) {
+        TopKEntry min = out[0];
+        TopKHeap_sift_down(out, n - 1, 0, out[n - 1], NULL);
+        out[n - 1] = min;
+    }
+    return (int)size;
+}
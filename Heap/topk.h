@@ -0,0 +1,58 @@
+/*
+ *  Streaming top-k collector: keeps the k highest-scoring (score, id) pairs seen so far.
+ */
+
+#ifndef TEMPLATE_TOPK_H
+#define TEMPLATE_TOPK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct TopK TopK;
+
+typedef struct {
+    double score;
+    int64_t id;
+} TopKEntry;
+
+/**
+ * @brief Creates an empty collector for the 'k' highest scores.
+ * @param k The number of entries to keep (greater than 0).
+ * @return TopK* The new collector, or NULL on failure.
+ */
+TopK *topk_new(int k);
+/**
+ * @brief Frees all memory associated with the collector.
+ */
+void topk_free(TopK *topk);
+/**
+ * @brief Offers one element, O(1) if it is rejected and O(log k) if it is kept.
+ * * Once k entries are held, an element is kept only if its score is strictly
+ * greater than the lowest held score. NaN scores are ignored.
+ */
+void topk_push(TopK *topk, double score, int64_t id);
+/**
+ * @brief Offers scores[0..n); compares four scores at a time against the current threshold.
+ * @param ids The ID of each score, or NULL to use the position i in the batch.
+ */
+void topk_push_batch(TopK *topk, const double scores[], const int64_t ids[], size_t n);
+/**
+ * @brief Offers every entry of 'src' to 'dst' (e.g. to combine per-thread collectors); 'src' is unchanged.
+ */
+void topk_merge(TopK *dst, const TopK *src);
+/**
+ * @brief Returns the lowest score a new element must beat, or -INFINITY while fewer than k entries are held.
+ */
+double topk_threshold(const TopK *topk);
+/**
+ * @brief Returns the number of entries held (at most k).
+ */
+int topk_size(const TopK *topk);
+/**
+ * @brief Copies the held entries into 'out', highest score first; the collector is unchanged.
+ * @param out Receives topk_size entries.
+ * @return int The number of entries written.
+ */
+int topk_results(const TopK *topk, TopKEntry out[]);
+
+#endif //TEMPLATE_TOPK_H
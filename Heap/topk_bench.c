@@ -0,0 +1,124 @@
+/*
+ *  Benchmark: top-k of a stream with TopK (scalar and batched) against a GenericHeap push + pop per element.
+ *  Usage: topk-bench [num_elements] [k] [num_collectors]
+ *         (default: 64M elements, k = 100, 4 collectors merged)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "generic_heap.h"
+#include "topk.h"
+#include "../bench_util.h"
+
+#define STREAM_CHUNK 4096
+
+static int entry_min_comp(const void *a, const void *b) {
+    double x = ((const TopKEntry *)a)->score;
+    double y = ((const TopKEntry *)b)->score;
+    return (x < y) - (x > y);
+}
+
+static int same_results(const TopKEntry a[], const TopKEntry b[], int k) {
+    for (int i = 0; i < k; i++) {
+        if (a[i].score != b[i].score || (i > 0 && a[i].score > a[i - 1].score)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : (size_t)1 << 26;
+    int k = argc > 2 ? atoi(argv[2]) : 100;
+    int num_collectors = argc > 3 ? atoi(argv[3]) : 4;
+    if (k < 1) k = 1;
+    if (num_collectors < 1) num_collectors = 1;
+
+    double *scores = malloc(sizeof(double) * (n > 0 ? n : 1));
+    int64_t *ids = malloc(sizeof(int64_t) * (n > 0 ? n : 1));
+    TopKEntry *expected = malloc(sizeof(TopKEntry) * k);
+    TopKEntry *actual = malloc(sizeof(TopKEntry) * k);
+    GenericHeap *heap = heap_new(sizeof(TopKEntry), entry_min_comp);
+    TopK *scalar = topk_new(k);
+    TopK *batched = topk_new(k);
+    TopK *merged = topk_new(k);
+    if (!scores || !ids || !expected || !actual || !heap || !scalar || !batched || !merged) {
+        fprintf(stderr, "Allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 23;
+    for (size_t i = 0; i < n; i++) {
+        scores[i] = (double)(next_rand(&state) >> 11) * 0x1.0p-53;
+        ids[i] = (int64_t)i;
+    }
+
+    double start = now_sec();
+    for (size_t i = 0; i < n; i++) {
+        heap_push(heap, &(TopKEntry){scores[i], ids[i]});
+        if (heap_size(heap) > (size_t)k) {
+            heap_pop(heap, NULL);
+        }
+    }
+    double heap_time = now_sec() - start;
+    int held = (int)heap_size(heap);
+    for (int i = held - 1; i >= 0; i--) {
+        heap_pop(heap, &expected[i]);
+    }
+
+    start = now_sec();
+    for (size_t i = 0; i < n; i++) {
+        topk_push(scalar, scores[i], ids[i]);
+    }
+    double scalar_time = now_sec() - start;
+
+    start = now_sec();
+    for (size_t i = 0; i < n; i += STREAM_CHUNK) {
+        size_t count = n - i < STREAM_CHUNK ? n - i : STREAM_CHUNK;
+        topk_push_batch(batched, &scores[i], &ids[i], count);
+    }
+    double batch_time = now_sec() - start;
+
+    // Per-thread collectors: each takes a contiguous slice, then all are merged into one.
+    start = now_sec();
+    for (int c = 0; c < num_collectors; c++) {
+        TopK *part = topk_new(k);
+        if (!part) {
+            return 1;
+        }
+        size_t lo = n / num_collectors * c;
+        size_t hi = c == num_collectors - 1 ? n : n / num_collectors * (c + 1);
+        topk_push_batch(part, &scores[lo], &ids[lo], hi - lo);
+        topk_merge(merged, part);
+        topk_free(part);
+    }
+    double merge_time = now_sec() - start;
+
+    int mismatch = 0;
+    TopK *collectors[] = {scalar, batched, merged};
+    for (int c = 0; c < 3; c++) {
+        mismatch |= topk_results(collectors[c], actual) != held || !same_results(expected, actual, held);
+    }
+
+    printf("n=%zu  k=%d\n", n, k);
+    printf("  GenericHeap push+pop  %7.3f s  %7.1f M/s\n", heap_time, n / heap_time / 1e6);
+    printf("  topk_push             %7.3f s  %7.1f M/s  -> %.2fx\n", scalar_time, n / scalar_time / 1e6,
+           heap_time / scalar_time);
+    printf("  topk_push_batch       %7.3f s  %7.1f M/s  -> %.2fx\n", batch_time, n / batch_time / 1e6,
+           heap_time / batch_time);
+    printf("  %d collectors + merge  %7.3f s  %7.1f M/s%s\n", num_collectors, merge_time, n / merge_time / 1e6,
+           mismatch ? "  MISMATCH" : "");
+
+    heap_free(heap);
+    topk_free(scalar);
+    topk_free(batched);
+    topk_free(merged);
+    free(scores);
+    free(ids);
+    free(expected);
+    free(actual);
+    return 0;
+}
@@ -6,78 +6,20 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <limits.h>
-#include <string.h> // For memset, used in DSU
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+#include "MinCostSpanninTree.h"
+#include "../DSU/DSU.h"
+#include "../Heap/dary_heap.h"
 
 // ----------------------------------------------------------------------
-// I. Mandatory Graph Structures
-// ----------------------------------------------------------------------
-
-/**
- * @brief Structure representing an edge in the graph.
- */
-typedef struct {
-    int u, v;       ///< The two vertices connected by the edge (source and destination).
-    int weight;     ///< The weight/cost of the edge.
-} Edge;
-
-// ----------------------------------------------------------------------
-// II. Disjoint Set Union (DSU) Implementation (from DSU.c)
-// ----------------------------------------------------------------------
-
-#define DSU_MAX_SIZE 100 // Renamed to avoid conflicts, ensure this is large enough for your graphs
-int parent[DSU_MAX_SIZE];
-int rank_arr[DSU_MAX_SIZE];
-
-/**
- * @brief Initializes the DSU structure for 'n' elements (0 to n-1).
- * @param n The number of elements to initialize.
- */
-void dsu_init(int n) {
-    for (int i = 0; i < n; i++) {
-        parent[i] = i;
-        rank_arr[i] = 0;
-    }
-}
-
-/**
- * @brief Finds the representative (root) of the set containing element 'i'.
- * Uses Path Compression.
- * @param i The element index.
- * @return int The root of the set containing i.
- */
-int dsu_find(int i) {
-    if (parent[i] == i) {
-        return i;
-    }
-    return parent[i] = dsu_find(parent[i]);
-}
-
-/**
- * @brief Merges the sets containing elements 'i' and 'j'. Uses Union by Rank.
- * @param i The first element index.
- * @param j The second element index.
- * @return int 1 if the union was successful (they were in different sets), 0 otherwise.
- */
-int dsu_union(int i, int j) {
-    int root_i = dsu_find(i);
-    int root_j = dsu_find(j);
-
-    if (root_i != root_j) {
-        if (rank_arr[root_i] < rank_arr[root_j]) {
-            parent[root_i] = root_j;
-        } else if (rank_arr[root_i] > rank_arr[root_j]) {
-            parent[root_j] = root_i;
-        } else {
-            parent[root_j] = root_i;
-            rank_arr[root_i]++;
-        }
-        return 1;
-    }
-    return 0;
-}
-
-// ----------------------------------------------------------------------
-// III. Heap Implementation (from Heap.c) - Required for Prim's *with decrease-key* or simply to manage keys.
+// I. Heap Implementation (from Heap.c) - Required for Prim's *with decrease-key* or simply to manage keys.
 //      (Included here as utility functions only, the Prim template uses an array-based simplification)
 // ----------------------------------------------------------------------
 
@@ -198,7 +140,7 @@ void deleteHeap(Heap *heap) {
 }
 
 // ----------------------------------------------------------------------
-// IV. Kruskal's Algorithm Template
+// II. Kruskal's Algorithm Template
 // ----------------------------------------------------------------------
 
 /**
@@ -208,57 +150,339 @@ void deleteHeap(Heap *heap) {
  * @return int A value < 0 if edgeA's weight is less than edgeB's, 0 if equal, and > 0 otherwise.
  */
 int compareEdges(const void* a, const void* b) {
-    Edge *edgeA = (Edge *)a;
-    Edge *edgeB = (Edge *)b;
-    return edgeA->weight - edgeB->weight;
+    const Edge *edgeA = (const Edge *)a;
+    const Edge *edgeB = (const Edge *)b;
+    // (x > y) - (x < y) instead of x - y, which overflows for weights of opposite sign.
+    return (edgeA->weight > edgeB->weight) - (edgeA->weight < edgeB->weight);
+}
+
+#define RADIX_SORT_CUTOFF 256 ///< Below this size qsort beats the four histogram passes.
+
+/**
+ * @brief Sorts edges by weight (ascending) with an LSD radix sort over the four weight bytes.
+ * * The sign bit is flipped so that negative weights order correctly as unsigned keys.
+ * Byte positions on which every key agrees are skipped, so graphs with small
+ * weights usually need only one or two passes. Falls back to qsort for tiny
+ * inputs or when the scratch buffer cannot be allocated.
+ * @param edges The edges to sort in place.
+ * @param num_edges The number of edges.
+ */
+void radix_sort_edges(Edge edges[], int num_edges) {
+    if (num_edges < RADIX_SORT_CUTOFF) {
+        qsort(edges, num_edges, sizeof(Edge), compareEdges);
+        return;
+    }
+    Edge *buffer = (Edge *)malloc(sizeof(Edge) * num_edges);
+    if (!buffer) {
+        qsort(edges, num_edges, sizeof(Edge), compareEdges);
+        return;
+    }
+
+    // One read pass builds the histograms of all four digits.
+    size_t count[4][256] = {{0}};
+    for (int i = 0; i < num_edges; i++) {
+        unsigned int key = (unsigned int)edges[i].weight ^ 0x80000000U;
+        count[0][key & 0xFF]++;
+        count[1][(key >> 8) & 0xFF]++;
+        count[2][(key >> 16) & 0xFF]++;
+        count[3][key >> 24]++;
+    }
+
+    Edge *src = edges;
+    Edge *dst = buffer;
+    for (int pass = 0; pass < 4; pass++) {
+        int shift = pass * 8;
+        unsigned int first_digit = (((unsigned int)src[0].weight ^ 0x80000000U) >> shift) & 0xFF;
+        if (count[pass][first_digit] == (size_t)num_edges) {
+            continue; // every key has the same digit here
+        }
+
+        size_t offset[256];
+        size_t sum = 0;
+        for (int d = 0; d < 256; d++) {
+            offset[d] = sum;
+            sum += count[pass][d];
+        }
+        for (int i = 0; i < num_edges; i++) {
+            unsigned int digit = (((unsigned int)src[i].weight ^ 0x80000000U) >> shift) & 0xFF;
+            dst[offset[digit]++] = src[i];
+        }
+
+        Edge *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != edges) {
+        memcpy(edges, src, sizeof(Edge) * num_edges);
+    }
+    free(buffer);
+}
+
+/**
+ * @brief State shared by the Kruskal scans of one MCST computation.
+ */
+typedef struct {
+    DSU *dsu;
+    long long min_cost;
+    int edges_in_mst;
+    int target;       ///< num_vertices - 1, the size of a spanning tree.
+    Edge *forest;     ///< Receives the selected edges in order, or NULL.
+} KruskalState;
+
+/**
+ * @brief Adds the edges of an already sorted array to the MCST in order.
+ */
+static void kruskal_scan(KruskalState *state, const Edge edges[], int num_edges) {
+    for (int i = 0; i < num_edges && state->edges_in_mst < state->target; i++) {
+        if (dsu_union(state->dsu, edges[i].u, edges[i].v) > 0) {
+            if (state->forest) {
+                state->forest[state->edges_in_mst] = edges[i];
+            }
+            state->min_cost += edges[i].weight;
+            state->edges_in_mst++;
+        }
+    }
 }
 
 /**
  * @brief Computes the Minimal Cost Spanning Tree (MCST) using Kruskal's Algorithm.
+ * * Edges are sorted with radix_sort_edges; edges_array is reordered in place.
  * @param num_vertices The number of vertices in the graph (0 to num_vertices-1).
  * @param edges_array The array containing all edges of the graph.
  * @param num_edges The total number of edges in the graph.
  * @return long long The total weight of the MCST. Returns -1 if the graph is disconnected.
  */
 long long kruskal_mcst(int num_vertices, Edge edges_array[], int num_edges) {
-    dsu_init(num_vertices);
+    DSU *dsu = dsu_new(num_vertices);
+    if (!dsu) {
+        return -1;
+    }
+
+    radix_sort_edges(edges_array, num_edges);
 
-    qsort(edges_array, num_edges, sizeof(Edge), compareEdges);
+    KruskalState state = {dsu, 0, 0, num_vertices - 1, NULL};
+    kruskal_scan(&state, edges_array, num_edges);
+    dsu_free(dsu);
+
+    if (state.edges_in_mst == state.target) {
+        return state.min_cost;
+    } else {
+        return -1;
+    }
+}
+
+/**
+ * @brief Kruskal's Algorithm that also returns the selected edges.
+ * * Unlike kruskal_mcst, a disconnected graph yields its minimum spanning forest.
+ * @param num_vertices The number of vertices in the graph (0 to num_vertices-1).
+ * @param edges_array The array containing all edges of the graph (reordered in place).
+ * @param num_edges The total number of edges in the graph.
+ * @param forest Output array of at least num_vertices-1 edges; receives the forest in ascending weight order.
+ * @param forest_size Output: number of edges in the forest.
+ * @return long long The total weight of the forest, or -1 on allocation failure.
+ */
+long long kruskal_mcst_forest(int num_vertices, Edge edges_array[], int num_edges, Edge forest[], int *forest_size) {
+    DSU *dsu = dsu_new(num_vertices);
+    if (!dsu) {
+        return -1;
+    }
+
+    radix_sort_edges(edges_array, num_edges);
+
+    KruskalState state = {dsu, 0, 0, num_vertices - 1, forest};
+    kruskal_scan(&state, edges_array, num_edges);
+    dsu_free(dsu);
+
+    *forest_size = state.edges_in_mst;
+    return state.min_cost;
+}
+
+#define FILTER_KRUSKAL_CUTOFF 4096 ///< Partitions at most this large are sorted directly.
+
+/**
+ * @brief xorshift32 step, used to draw pivot samples.
+ */
+static unsigned int next_random(unsigned int *seed) {
+    unsigned int x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *seed = x;
+}
+
+/**
+ * @brief Recursive step of Filter-Kruskal.
+ * * Partitions the edges around a pivot weight, solves the light half first,
+ * then discards every heavy edge whose endpoints are already connected before
+ * the heavy half is partitioned or sorted.
+ */
+static void filter_kruskal_step(KruskalState *state, Edge edges[], int num_edges, unsigned int *seed) {
+    if (state->edges_in_mst == state->target || num_edges == 0) {
+        return;
+    }
+    if (num_edges <= FILTER_KRUSKAL_CUTOFF) {
+        radix_sort_edges(edges, num_edges);
+        kruskal_scan(state, edges, num_edges);
+        return;
+    }
 
-    long long min_cost = 0;
-    int edges_in_mst = 0;
+    // Median of three random samples as the pivot weight.
+    int a = edges[next_random(seed) % num_edges].weight;
+    int b = edges[next_random(seed) % num_edges].weight;
+    int c = edges[next_random(seed) % num_edges].weight;
+    int pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
 
+    // Light edges (weight <= pivot) to the front.
+    int light = 0;
     for (int i = 0; i < num_edges; i++) {
-        Edge current_edge = edges_array[i];
-        int u = current_edge.u;
-        int v = current_edge.v;
-
-        if (dsu_find(u) != dsu_find(v)) {
-            dsu_union(u, v);
-            min_cost += current_edge.weight;
-            edges_in_mst++;
+        if (edges[i].weight <= pivot) {
+            Edge temp = edges[light];
+            edges[light] = edges[i];
+            edges[i] = temp;
+            light++;
         }
+    }
+    if (light == num_edges) {
+        // Pivot is the maximum weight, so partitioning cannot shrink the problem.
+        radix_sort_edges(edges, num_edges);
+        kruskal_scan(state, edges, num_edges);
+        return;
+    }
 
-        if (edges_in_mst == num_vertices - 1) {
-            break;
+    filter_kruskal_step(state, edges, light, seed);
+
+    // Filter: keep only heavy edges that still join two different components.
+    Edge *heavy = edges + light;
+    int kept = 0;
+    for (int i = 0; i < num_edges - light && state->edges_in_mst < state->target; i++) {
+        if (dsu_find(state->dsu, heavy[i].u) != dsu_find(state->dsu, heavy[i].v)) {
+            heavy[kept++] = heavy[i];
         }
     }
+    filter_kruskal_step(state, heavy, kept, seed);
+}
 
-    if (edges_in_mst == num_vertices - 1) {
-        return min_cost;
+/**
+ * @brief Computes the MCST using Filter-Kruskal.
+ * * Gives the same cost as kruskal_mcst, but edges heavier than the MCST needs
+ * are usually dropped by a cheap connectivity check before they are sorted.
+ * edges_array is reordered in place.
+ * @param num_vertices The number of vertices in the graph (0 to num_vertices-1).
+ * @param edges_array The array containing all edges of the graph.
+ * @param num_edges The total number of edges in the graph.
+ * @return long long The total weight of the MCST. Returns -1 if the graph is disconnected.
+ */
+long long filter_kruskal_mcst(int num_vertices, Edge edges_array[], int num_edges) {
+    DSU *dsu = dsu_new(num_vertices);
+    if (!dsu) {
+        return -1;
+    }
+
+    KruskalState state = {dsu, 0, 0, num_vertices - 1, NULL};
+    unsigned int seed = 12345;
+    filter_kruskal_step(&state, edges_array, num_edges, &seed);
+    dsu_free(dsu);
+
+    if (state.edges_in_mst == state.target) {
+        return state.min_cost;
     } else {
         return -1;
     }
 }
 
 // ----------------------------------------------------------------------
-// V. Prim's Algorithm Template
+// III. Prim's Algorithm Template
 // ----------------------------------------------------------------------
 
+/**
+ * @brief Prim's key update for the row of the vertex just added, fused with the next Extract Min.
+ * * For every v: key[v] = min(key[v], max(row[v], clamp[v])), where clamp[v] is INT_MIN
+ * for vertices outside the MST and INT_MAX for vertices inside it (whose key is also
+ * INT_MAX), so finished vertices are never lowered or selected. The same pass tracks
+ * the minimum new key and its index, so both O(V) loops become one branchless loop.
+ * Uses AVX2 or SSE4.1 when the compiler targets them, with a scalar fallback.
+ * @param u_out Receives the vertex with the smallest key (first one on ties).
+ * @return int That smallest key; INT_MAX if no vertex outside the MST is reachable.
+ */
+static int dense_update_extract_min(int *key, const int *clamp, const int *row, int n, int *u_out) {
+    int v = 0;
+    int min_key = INT_MAX;
+    int u = -1;
+
+#if defined(__AVX2__)
+    __m256i best = _mm256_set1_epi32(INT_MAX);
+    __m256i best_index = _mm256_set1_epi32(-1);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(8);
+    for (; v + 8 <= n; v += 8) {
+        __m256i k = _mm256_loadu_si256((const __m256i *)(key + v));
+        __m256i r = _mm256_max_epi32(_mm256_loadu_si256((const __m256i *)(row + v)),
+                                     _mm256_loadu_si256((const __m256i *)(clamp + v)));
+        k = _mm256_min_epi32(k, r);
+        _mm256_storeu_si256((__m256i *)(key + v), k);
+        __m256i lower = _mm256_cmpgt_epi32(best, k);
+        best = _mm256_min_epi32(best, k);
+        best_index = _mm256_blendv_epi8(best_index, index, lower);
+        index = _mm256_add_epi32(index, step);
+    }
+    int lanes_key[8], lanes_index[8];
+    _mm256_storeu_si256((__m256i *)lanes_key, best);
+    _mm256_storeu_si256((__m256i *)lanes_index, best_index);
+    for (int lane = 0; lane < 8; lane++) {
+        if (lanes_key[lane] < min_key || (lanes_key[lane] == min_key && lanes_index[lane] < u)) {
+            min_key = lanes_key[lane];
+            u = lanes_index[lane];
+        }
+    }
+#elif defined(__SSE4_1__)
+    __m128i best = _mm_set1_epi32(INT_MAX);
+    __m128i best_index = _mm_set1_epi32(-1);
+    __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i step = _mm_set1_epi32(4);
+    for (; v + 4 <= n; v += 4) {
+        __m128i k = _mm_loadu_si128((const __m128i *)(key + v));
+        __m128i r = _mm_max_epi32(_mm_loadu_si128((const __m128i *)(row + v)),
+                                  _mm_loadu_si128((const __m128i *)(clamp + v)));
+        k = _mm_min_epi32(k, r);
+        _mm_storeu_si128((__m128i *)(key + v), k);
+        __m128i lower = _mm_cmpgt_epi32(best, k);
+        best = _mm_min_epi32(best, k);
+        best_index = _mm_blendv_epi8(best_index, index, lower);
+        index = _mm_add_epi32(index, step);
+    }
+    int lanes_key[4], lanes_index[4];
+    _mm_storeu_si128((__m128i *)lanes_key, best);
+    _mm_storeu_si128((__m128i *)lanes_index, best_index);
+    for (int lane = 0; lane < 4; lane++) {
+        if (lanes_key[lane] < min_key || (lanes_key[lane] == min_key && lanes_index[lane] < u)) {
+            min_key = lanes_key[lane];
+            u = lanes_index[lane];
+        }
+    }
+#endif
+
+    // Scalar tail (or the whole row without SIMD support).
+    for (; v < n; v++) {
+        int r = row[v] > clamp[v] ? row[v] : clamp[v];
+        int k = key[v] < r ? key[v] : r;
+        key[v] = k;
+        if (k < min_key) {
+            min_key = k;
+            u = v;
+        }
+    }
+
+    *u_out = u;
+    return min_key;
+}
+
 /**
  * @brief Computes the Minimal Cost Spanning Tree (MCST) using Prim's Algorithm.
  * * This implementation uses an array-based approach to simulate the priority queue's
  * 'Extract Min' operation (O(V) complexity per step), resulting in O(V^2) total time.
+ * Each step is a single vectorized pass (see dense_update_extract_min), which suits
+ * dense, near-complete graphs.
  *
  * @param num_vertices The number of vertices in the graph (0 to num_vertices-1).
  * @param adj_matrix The graph's adjacency matrix where adj_matrix[u][v] is the edge weight.
@@ -266,55 +490,347 @@ long long kruskal_mcst(int num_vertices, Edge edges_array[], int num_edges) {
  * @return long long The total weight of the MCST. Returns -1 if the graph is disconnected.
  */
 long long prim_mcst(int num_vertices, int adj_matrix[num_vertices][num_vertices]) {
-    if (num_vertices > DSU_MAX_SIZE) {
-        fprintf(stderr, "Error: Graph size exceeds MAX_SIZE limit for this template.\n");
-        return -1;
-    }
-
     // key[i]: Minimum weight to connect vertex i to the MST
     int *key = (int *)malloc(sizeof(int) * num_vertices);
-    // in_mst[i]: Tracks if vertex i is already included in the MST
-    bool *in_mst = (bool *)malloc(sizeof(bool) * num_vertices);
+    // clamp[i]: INT_MIN while vertex i is outside the MST, INT_MAX once it is included
+    int *clamp = (int *)malloc(sizeof(int) * num_vertices);
+    if (!key || !clamp) {
+        free(key);
+        free(clamp);
+        return -1;
+    }
 
     // Initialization
     for (int i = 0; i < num_vertices; i++) {
         key[i] = INT_MAX;
-        in_mst[i] = false;
+        clamp[i] = INT_MIN;
     }
 
-    key[0] = 0;
     long long total_cost = 0;
     int mst_size = 0;
+    int u = 0;
+    int min_key = 0;
 
     while (mst_size < num_vertices) {
-        // Step 1: Extract Min (O(V) time)
-        int min_key = INT_MAX;
-        int u = -1;
-        for (int v = 0; v < num_vertices; v++) {
-            if (in_mst[v] == false && key[v] < min_key) {
-                min_key = key[v];
-                u = v;
+        total_cost += min_key;
+        mst_size++;
+        key[u] = INT_MAX;
+        clamp[u] = INT_MAX;
+
+        // Update keys from u's row and Extract Min in one pass (O(V) time)
+        min_key = dense_update_extract_min(key, clamp, adj_matrix[u], num_vertices, &u);
+        if (min_key == INT_MAX) {
+            break;
+        }
+    }
+
+    free(key);
+    free(clamp);
+
+    if (mst_size == num_vertices) {
+        return total_cost;
+    } else {
+        return -1;
+    }
+}
+
+// ----------------------------------------------------------------------
+// IV. Parallel Boruvka's Algorithm
+// ----------------------------------------------------------------------
+
+#define BORUVKA_NONE UINT64_MAX ///< best[] value of a component without an outgoing edge.
+
+/**
+ * @brief Per-thread state of one Boruvka round. Each worker owns a fixed slice
+ * of the edge array and compacts its live edges to the front of that slice.
+ */
+typedef struct {
+    Edge *edges;
+    int lo;                  ///< First index of this worker's slice.
+    int live;                ///< Live edges are edges[lo .. lo+live).
+    const int *label;        ///< label[v]: component (root vertex) of v in this round.
+    _Atomic uint64_t *best;  ///< best[c]: packed (weight, edge index) of c's lightest outgoing edge.
+} BoruvkaWorker;
+
+/**
+ * @brief Lowers *target to value if value is smaller (lock-free).
+ */
+static void atomic_min_u64(_Atomic uint64_t *target, uint64_t value) {
+    uint64_t current = atomic_load_explicit(target, memory_order_relaxed);
+    while (value < current &&
+           !atomic_compare_exchange_weak_explicit(target, &current, value,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief One round over a worker's slice: drops edges inside a component and
+ * offers every other edge as the lightest outgoing edge of both endpoints.
+ */
+static void *boruvka_scan(void *arg) {
+    BoruvkaWorker *worker = arg;
+    Edge *slice = worker->edges + worker->lo;
+    int kept = 0;
+
+    for (int i = 0; i < worker->live; i++) {
+        Edge e = slice[i];
+        int cu = worker->label[e.u];
+        int cv = worker->label[e.v];
+        if (cu == cv) {
+            continue;
+        }
+        slice[kept] = e;
+        // Weight in the high half (sign-flipped so it orders as unsigned), edge index
+        // in the low half: a strict total order, so equal weights cannot form a cycle.
+        uint64_t key = ((uint64_t)((unsigned int)e.weight ^ 0x80000000U) << 32) |
+                       (uint32_t)(worker->lo + kept);
+        atomic_min_u64(&worker->best[cu], key);
+        atomic_min_u64(&worker->best[cv], key);
+        kept++;
+    }
+    worker->live = kept;
+    return NULL;
+}
+
+long long boruvka_mcst(int num_vertices, const Edge edges_array[], int num_edges, int num_threads,
+                       Edge forest[], int *forest_size) {
+    if (num_threads < 1) {
+        num_threads = 1;
+    }
+
+    Edge *edges = (Edge *)malloc(sizeof(Edge) * (num_edges > 0 ? num_edges : 1));
+    int *label = (int *)malloc(sizeof(int) * num_vertices);
+    _Atomic uint64_t *best = malloc(sizeof(_Atomic uint64_t) * num_vertices);
+    BoruvkaWorker *workers = (BoruvkaWorker *)malloc(sizeof(BoruvkaWorker) * num_threads);
+    pthread_t *threads = (pthread_t *)malloc(sizeof(pthread_t) * num_threads);
+    DSU *dsu = dsu_new(num_vertices);
+    if (!edges || !label || !best || !workers || !threads || !dsu) {
+        fprintf(stderr, "Error: Boruvka allocation failed!\n");
+        free(edges);
+        free(label);
+        free(best);
+        free(workers);
+        free(threads);
+        dsu_free(dsu);
+        return -1;
+    }
+
+    memcpy(edges, edges_array, sizeof(Edge) * num_edges);
+    for (int v = 0; v < num_vertices; v++) {
+        label[v] = v;
+        atomic_init(&best[v], BORUVKA_NONE);
+    }
+    int chunk = (num_edges + num_threads - 1) / num_threads;
+    for (int t = 0; t < num_threads; t++) {
+        int lo = chunk * t < num_edges ? chunk * t : num_edges;
+        int hi = lo + chunk < num_edges ? lo + chunk : num_edges;
+        workers[t] = (BoruvkaWorker){edges, lo, hi - lo, label, best};
+    }
+
+    long long total_cost = 0;
+    int edges_in_forest = 0;
+
+    for (;;) {
+        // Step 1: lightest outgoing edge of every component, in parallel over the edges.
+        // If a thread fails to start, the calling thread scans that slice and all later ones.
+        int started = 1;
+        while (started < num_threads && pthread_create(&threads[started], NULL, boruvka_scan, &workers[started]) == 0) {
+            started++;
+        }
+        for (int t = started; t < num_threads; t++) {
+            boruvka_scan(&workers[t]);
+        }
+        boruvka_scan(&workers[0]);
+        for (int t = 1; t < started; t++) {
+            pthread_join(threads[t], NULL);
+        }
+
+        // Step 2: contract along the selected edges.
+        int merged = 0;
+        for (int c = 0; c < num_vertices; c++) {
+            uint64_t key = atomic_load_explicit(&best[c], memory_order_relaxed);
+            if (label[c] != c || key == BORUVKA_NONE) {
+                continue;
+            }
+            Edge e = edges[key & 0xFFFFFFFFU];
+            // Two components may pick the same edge; only the first union counts.
+            if (dsu_union(dsu, e.u, e.v) > 0) {
+                total_cost += e.weight;
+                if (forest) {
+                    forest[edges_in_forest] = e;
+                }
+                edges_in_forest++;
+                merged++;
             }
         }
+        if (merged == 0) {
+            break; // every remaining component has no outgoing edge
+        }
 
-        if (u == -1) {
-            break;
+        for (int v = 0; v < num_vertices; v++) {
+            label[v] = (int)dsu_find(dsu, v);
+            atomic_store_explicit(&best[v], BORUVKA_NONE, memory_order_relaxed);
         }
+    }
 
-        in_mst[u] = true;
-        total_cost += min_key;
+    if (forest_size) {
+        *forest_size = edges_in_forest;
+    }
+    free(edges);
+    free(label);
+    free(best);
+    free(workers);
+    free(threads);
+    dsu_free(dsu);
+    return total_cost;
+}
+
+// ----------------------------------------------------------------------
+// V. Prim's Algorithm on a CSR Graph with an Indexed 4-ary Heap
+// ----------------------------------------------------------------------
+
+CSRGraph *csr_from_edges(int num_vertices, const Edge edges[], int num_edges) {
+    CSRGraph *graph = (CSRGraph *)malloc(sizeof(CSRGraph));
+    uint64_t *offsets = (uint64_t *)calloc((size_t)num_vertices + 1, sizeof(uint64_t));
+    uint64_t num_arcs = 2 * (uint64_t)num_edges;
+    int *targets = (int *)malloc(sizeof(int) * (num_arcs > 0 ? num_arcs : 1));
+    int *weights = (int *)malloc(sizeof(int) * (num_arcs > 0 ? num_arcs : 1));
+    if (!graph || !offsets || !targets || !weights) {
+        fprintf(stderr, "Error: CSR allocation failed!\n");
+        free(graph);
+        free(offsets);
+        free(targets);
+        free(weights);
+        return NULL;
+    }
+
+    // Counting sort of both directions of every edge by source vertex.
+    for (int i = 0; i < num_edges; i++) {
+        offsets[edges[i].u + 1]++;
+        offsets[edges[i].v + 1]++;
+    }
+    for (int v = 0; v < num_vertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    for (int i = 0; i < num_edges; i++) {
+        uint64_t a = offsets[edges[i].u]++;
+        targets[a] = edges[i].v;
+        weights[a] = edges[i].weight;
+        uint64_t b = offsets[edges[i].v]++;
+        targets[b] = edges[i].u;
+        weights[b] = edges[i].weight;
+    }
+    // The fill loop advanced offsets[v] to the start of v + 1; shift back.
+    for (int v = num_vertices; v > 0; v--) {
+        offsets[v] = offsets[v - 1];
+    }
+    offsets[0] = 0;
+
+    graph->num_vertices = num_vertices;
+    graph->num_arcs = num_arcs;
+    graph->offsets = offsets;
+    graph->targets = targets;
+    graph->weights = weights;
+    return graph;
+}
+
+void csr_free(CSRGraph *graph) {
+    if (graph) {
+        free((void *)graph->offsets);
+        free((void *)graph->targets);
+        free((void *)graph->weights);
+        free(graph);
+    }
+}
+
+#define PRIM_HEAP_D 4        ///< Heap arity; the 4 children of a node share one cache line.
+#define PRIM_NOT_SEEN (-1)   ///< pos[] value of a vertex that has never been in the heap.
+#define PRIM_DONE (-2)       ///< pos[] value of a vertex already in the MCST.
+
+/**
+ * @brief Heap entry. The key is stored next to the vertex so sifting never reads key[].
+ */
+typedef struct {
+    int key;
+    int vertex;
+} PrimHeapEntry;
+
+/**
+ * @brief Indexed min-heap: pos[v] is the index of vertex v in heap[].
+ */
+typedef struct {
+    PrimHeapEntry *heap;
+    int *pos;
+    int size;
+} PrimHeap;
+
+#define PRIM_KEY_LOWER(a, b) ((a).key < (b).key)
+#define PRIM_POS_MOVED(pos, entry, index) (((int *)(pos))[(entry).vertex] = (int)(index))
+
+DARY_HEAP_DEFINE_SIFT(PrimSift, PrimHeapEntry, PRIM_KEY_LOWER, PRIM_HEAP_D, PRIM_POS_MOVED)
+
+static inline void prim_sift_up(PrimHeap *pq, int i, PrimHeapEntry entry) {
+    PrimSift_sift_up(pq->heap, (size_t)i, entry, pq->pos);
+}
+
+static inline void prim_sift_down(PrimHeap *pq, int i, PrimHeapEntry entry) {
+    PrimSift_sift_down(pq->heap, (size_t)pq->size, (size_t)i, entry, pq->pos);
+}
+
+long long prim_csr_mcst(const CSRGraph *graph) {
+    int num_vertices = graph->num_vertices;
+    if (num_vertices <= 0) {
+        return -1;
+    }
+
+    PrimHeap pq;
+    pq.heap = (PrimHeapEntry *)malloc(sizeof(PrimHeapEntry) * num_vertices);
+    pq.pos = (int *)malloc(sizeof(int) * num_vertices);
+    pq.size = 0;
+    if (!pq.heap || !pq.pos) {
+        fprintf(stderr, "Error: Prim heap allocation failed!\n");
+        free(pq.heap);
+        free(pq.pos);
+        return -1;
+    }
+    for (int v = 0; v < num_vertices; v++) {
+        pq.pos[v] = PRIM_NOT_SEEN;
+    }
+
+    long long total_cost = 0;
+    int mst_size = 0;
+    prim_sift_up(&pq, pq.size++, (PrimHeapEntry){0, 0});
+
+    while (pq.size > 0) {
+        // Step 1: Extract Min (O(log V))
+        PrimHeapEntry top = pq.heap[0];
+        pq.size--;
+        if (pq.size > 0) {
+            prim_sift_down(&pq, 0, pq.heap[pq.size]);
+        }
+        pq.pos[top.vertex] = PRIM_DONE;
+        total_cost += top.key;
         mst_size++;
 
-        // Step 2: Update adjacent vertices' key values (O(V) time)
-        for (int v = 0; v < num_vertices; v++) {
-            if (adj_matrix[u][v] != INT_MAX && in_mst[v] == false && adj_matrix[u][v] < key[v]) {
-                key[v] = adj_matrix[u][v];
+        // Step 2: insert or decrease-key every neighbour outside the MCST
+        int u = top.vertex;
+        for (uint64_t a = graph->offsets[u]; a < graph->offsets[u + 1]; a++) {
+            int v = graph->targets[a];
+            int w = graph->weights[a];
+            int p = pq.pos[v];
+            if (p == PRIM_DONE) {
+                continue;
+            }
+            if (p == PRIM_NOT_SEEN) {
+                prim_sift_up(&pq, pq.size++, (PrimHeapEntry){w, v});
+            } else if (w < pq.heap[p].key) {
+                prim_sift_up(&pq, p, (PrimHeapEntry){w, v});
             }
         }
     }
 
-    free(key);
-    free(in_mst);
+    free(pq.heap);
+    free(pq.pos);
 
     if (mst_size == num_vertices) {
         return total_cost;
@@ -322,49 +838,3 @@ long long prim_mcst(int num_vertices, int adj_matrix[num_vertices][num_vertices]
         return -1;
     }
 }
-
-#define NUM_VERTICES_EX 5
-#define NUM_EDGES_EX 7
-#define INF INT_MAX
-
-int main() {
-    // --- Kruskal Example ---
-    printf("--- Kruskal's Algorithm Example ---\n");
-    Edge kruskal_edges[NUM_EDGES_EX] = {
-        {0, 1, 10},
-        {0, 2, 6},
-        {0, 3, 5},
-        {1, 3, 15},
-        {2, 3, 4},
-        {3, 4, 16},
-        {2, 4, 7}
-    };
-
-    long long kruskal_cost = kruskal_mcst(NUM_VERTICES_EX, kruskal_edges, NUM_EDGES_EX);
-    if (kruskal_cost != -1) {
-        printf("Kruskal MCST Cost: %lld\n", kruskal_cost);
-    } else {
-        printf("Kruskal: Graph is disconnected.\n");
-    }
-
-    // --- Prim Example ---
-    printf("\n--- Prim's Algorithm Example ---\n");
-    // Adjacency Matrix representation
-    int prim_adj_matrix[NUM_VERTICES_EX][NUM_VERTICES_EX] = {
-        //   0   1   2   3   4
-        {INF, 10,  6,  5, INF}, // 0
-        { 10, INF, INF, 15, INF}, // 1
-        {  6, INF, INF,  4,  7}, // 2
-        {  5, 15,  4, INF, 16}, // 3
-        {INF, INF,  7, 16, INF}  // 4
-    };
-
-    long long prim_cost = prim_mcst(NUM_VERTICES_EX, prim_adj_matrix);
-    if (prim_cost != -1) {
-        printf("Prim MCST Cost: %lld\n", prim_cost);
-    } else {
-        printf("Prim: Graph is disconnected.\n");
-    }
-
-    return 0;
-}
\ No newline at end of file
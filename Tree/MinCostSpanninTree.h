@@ -0,0 +1,87 @@
+/*
+ *  Minimal Cost Spanning Tree (MCST) algorithms.
+ */
+
+#ifndef TEMPLATE_MIN_COST_SPANNING_TREE_H
+#define TEMPLATE_MIN_COST_SPANNING_TREE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Structure representing an edge in the graph.
+ */
+typedef struct {
+    int u, v;       ///< The two vertices connected by the edge (source and destination).
+    int weight;     ///< The weight/cost of the edge.
+} Edge;
+
+/**
+ * @brief Undirected graph in compressed sparse row (CSR) form.
+ * * The arcs leaving vertex v are targets[a] / weights[a] for
+ * offsets[v] <= a < offsets[v + 1]; every edge appears once in each direction.
+ */
+typedef struct {
+    int num_vertices;
+    uint64_t num_arcs;        ///< Twice the number of edges.
+    const uint64_t *offsets;  ///< num_vertices + 1 entries.
+    const int *targets;
+    const int *weights;
+} CSRGraph;
+
+/**
+ * @brief qsort comparator ordering edges by ascending weight.
+ */
+int compareEdges(const void* a, const void* b);
+/**
+ * @brief Sorts edges by ascending weight with an LSD radix sort.
+ */
+void radix_sort_edges(Edge edges[], int num_edges);
+/**
+ * @brief Kruskal's Algorithm. Reorders edges_array.
+ * @return long long The MCST cost, or -1 if the graph is disconnected.
+ */
+long long kruskal_mcst(int num_vertices, Edge edges_array[], int num_edges);
+/**
+ * @brief Kruskal's Algorithm keeping the selected edges (ascending weight). Reorders edges_array.
+ * @return long long The minimum spanning forest cost, or -1 on allocation failure.
+ */
+long long kruskal_mcst_forest(int num_vertices, Edge edges_array[], int num_edges, Edge forest[], int *forest_size);
+/**
+ * @brief Filter-Kruskal. Same result as kruskal_mcst; reorders edges_array.
+ * @return long long The MCST cost, or -1 if the graph is disconnected.
+ */
+long long filter_kruskal_mcst(int num_vertices, Edge edges_array[], int num_edges);
+/**
+ * @brief Prim's Algorithm on an adjacency matrix (INT_MAX = no edge), O(V^2).
+ * @return long long The MCST cost, or -1 if the graph is disconnected.
+ */
+long long prim_mcst(int num_vertices, int adj_matrix[num_vertices][num_vertices]);
+/**
+ * @brief Parallel Boruvka's Algorithm. Handles disconnected graphs.
+ * @param num_vertices The number of vertices in the graph (0 to num_vertices-1).
+ * @param edges_array The edges of the graph (not modified).
+ * @param num_edges The total number of edges in the graph.
+ * @param num_threads The number of worker threads (values < 1 mean 1).
+ * @param forest Output array of at least num_vertices-1 edges receiving the
+ * spanning forest, or NULL if only the cost is needed.
+ * @param forest_size Output: number of edges in the spanning forest (may be NULL).
+ * @return long long The total weight of the minimum spanning forest, or -1 on allocation failure.
+ */
+long long boruvka_mcst(int num_vertices, const Edge edges_array[], int num_edges, int num_threads,
+                       Edge forest[], int *forest_size);
+/**
+ * @brief Builds a CSR graph from an edge list with a counting sort, O(V + E).
+ * @return CSRGraph* The new graph (free with csr_free), or NULL on failure.
+ */
+CSRGraph *csr_from_edges(int num_vertices, const Edge edges[], int num_edges);
+/**
+ * @brief Frees a graph returned by csr_from_edges.
+ */
+void csr_free(CSRGraph *graph);
+/**
+ * @brief Prim's Algorithm on a CSR graph with an indexed 4-ary heap (decrease-key), O(E log V).
+ * @return long long The MCST cost, or -1 if the graph is disconnected.
+ */
+long long prim_csr_mcst(const CSRGraph *graph);
+
+#endif //TEMPLATE_MIN_COST_SPANNING_TREE_H
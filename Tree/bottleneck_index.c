@@ -0,0 +1,230 @@
+/*
+ *  Bottleneck path index based on the leaf order of a Kruskal reconstruction tree.
+ *
+ *  Replaying the forest edges in ascending weight order and concatenating the
+ *  vertex lists of the two merged components yields the leaf order of the
+ *  Kruskal reconstruction tree. Between neighbouring leaves i and i+1 we record
+ *  gap[i], the weight of the edge whose merge made them adjacent (the weight of
+ *  their lowest common ancestor). The heaviest edge on the path between u and v
+ *  is then the maximum of gap[] between their positions, so the LCA query
+ *  becomes a range-maximum query, answered in O(1) with a sparse table over
+ *  blocks of BOTTLENECK_BLOCK gaps plus two short in-block scans.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "bottleneck_index.h"
+#include "../DSU/DSU.h"
+
+#define BOTTLENECK_BLOCK 32
+
+struct BottleneckIndex {
+    int num_vertices;
+    int *position;    ///< position[v]: index of v in the leaf order.
+    int *component;   ///< component[v]: tree of v (the first leaf position of that tree).
+    int *gap;         ///< gap[i]: bottleneck between leaves i and i+1 of the same tree.
+    int num_blocks;
+    int *table;       ///< table[k * num_blocks + b]: max of blocks b .. b + 2^k - 1.
+};
+
+static inline int max_int(int a, int b) {
+    return a > b ? a : b;
+}
+
+static int scan_max(const int *gap, int lo, int hi) {
+    int best = INT_MIN;
+    for (int i = lo; i <= hi; i++) {
+        best = max_int(best, gap[i]);
+    }
+    return best;
+}
+
+/**
+ * @brief Maximum of gap[lo..hi] (inclusive, lo <= hi).
+ */
+static int range_max(const BottleneckIndex *index, int lo, int hi) {
+    int first_block = lo / BOTTLENECK_BLOCK;
+    int last_block = hi / BOTTLENECK_BLOCK;
+    if (first_block == last_block) {
+        return scan_max(index->gap, lo, hi);
+    }
+
+    int best = max_int(scan_max(index->gap, lo, (first_block + 1) * BOTTLENECK_BLOCK - 1),
+                       scan_max(index->gap, last_block * BOTTLENECK_BLOCK, hi));
+    if (first_block + 1 <= last_block - 1) {
+        int a = first_block + 1;
+        int b = last_block - 1;
+        int k = 31 - __builtin_clz((unsigned int)(b - a + 1));
+        const int *level = index->table + (size_t)k * index->num_blocks;
+        best = max_int(best, max_int(level[a], level[b - (1 << k) + 1]));
+    }
+    return best;
+}
+
+/**
+ * @brief Fills position[], component[] and gap[] by replaying the forest in ascending order.
+ * @return int 1 on success, 0 on allocation failure.
+ */
+static int build_leaf_order(BottleneckIndex *index, const Edge forest[], int num_forest_edges) {
+    int num_vertices = index->num_vertices;
+    Edge *sorted = malloc(sizeof(Edge) * (num_forest_edges > 0 ? num_forest_edges : 1));
+    int *next = malloc(sizeof(int) * num_vertices);
+    int *gap_after = malloc(sizeof(int) * num_vertices);
+    int *head = malloc(sizeof(int) * num_vertices);
+    int *tail = malloc(sizeof(int) * num_vertices);
+    DSU *dsu = dsu_new(num_vertices);
+    int status = sorted && next && gap_after && head && tail && dsu;
+
+    if (status) {
+        for (int i = 0; i < num_forest_edges; i++) {
+            sorted[i] = forest[i];
+        }
+        radix_sort_edges(sorted, num_forest_edges);
+        for (int v = 0; v < num_vertices; v++) {
+            next[v] = -1;
+            head[v] = v;
+            tail[v] = v;
+        }
+
+        // Merging two trees appends the leaf list of one to the other.
+        for (int i = 0; i < num_forest_edges; i++) {
+            int ru = (int)dsu_find(dsu, sorted[i].u);
+            int rv = (int)dsu_find(dsu, sorted[i].v);
+            if (ru == rv) {
+                continue;
+            }
+            next[tail[ru]] = head[rv];
+            gap_after[tail[ru]] = sorted[i].weight;
+            int new_head = head[ru];
+            int new_tail = tail[rv];
+            dsu_union(dsu, ru, rv);
+            int root = (int)dsu_find(dsu, ru);
+            head[root] = new_head;
+            tail[root] = new_tail;
+        }
+
+        // Lay the trees out one after another in leaf order.
+        int pos = 0;
+        for (int v = 0; v < num_vertices; v++) {
+            if ((int)dsu_find(dsu, v) != v) {
+                continue;
+            }
+            int first = pos;
+            for (int x = head[v]; x != -1; x = next[x]) {
+                index->position[x] = pos;
+                index->component[x] = first;
+                index->gap[pos] = next[x] != -1 ? gap_after[x] : INT_MIN;
+                pos++;
+            }
+        }
+    }
+
+    free(sorted);
+    free(next);
+    free(gap_after);
+    free(head);
+    free(tail);
+    dsu_free(dsu);
+    return status;
+}
+
+/**
+ * @brief Builds the sparse table over the maxima of the gap blocks.
+ * @return int 1 on success, 0 on allocation failure.
+ */
+static int build_block_table(BottleneckIndex *index) {
+    int num_vertices = index->num_vertices;
+    int num_blocks = (num_vertices + BOTTLENECK_BLOCK - 1) / BOTTLENECK_BLOCK;
+    int levels = 1;
+    while ((1 << levels) <= num_blocks) {
+        levels++;
+    }
+
+    index->num_blocks = num_blocks;
+    index->table = malloc(sizeof(int) * (size_t)levels * num_blocks);
+    if (!index->table) {
+        return 0;
+    }
+    for (int b = 0; b < num_blocks; b++) {
+        int hi = (b + 1) * BOTTLENECK_BLOCK - 1;
+        index->table[b] = scan_max(index->gap, b * BOTTLENECK_BLOCK, hi < num_vertices ? hi : num_vertices - 1);
+    }
+    for (int k = 1; k < levels; k++) {
+        const int *prev = index->table + (size_t)(k - 1) * num_blocks;
+        int *level = index->table + (size_t)k * num_blocks;
+        for (int b = 0; b + (1 << k) <= num_blocks; b++) {
+            level[b] = max_int(prev[b], prev[b + (1 << (k - 1))]);
+        }
+    }
+    return 1;
+}
+
+BottleneckIndex *bottleneck_index_new(int num_vertices, const Edge forest[], int num_forest_edges) {
+    if (num_vertices <= 0) {
+        fprintf(stderr, "BottleneckIndex size must be greater than 0!\n");
+        return NULL;
+    }
+
+    BottleneckIndex *index = calloc(1, sizeof(BottleneckIndex));
+    if (!index) {
+        fprintf(stderr, "BottleneckIndex allocation failed!\n");
+        return NULL;
+    }
+    index->num_vertices = num_vertices;
+    index->position = malloc(sizeof(int) * num_vertices);
+    index->component = malloc(sizeof(int) * num_vertices);
+    index->gap = malloc(sizeof(int) * num_vertices);
+
+    if (!index->position || !index->component || !index->gap ||
+        !build_leaf_order(index, forest, num_forest_edges) || !build_block_table(index)) {
+        fprintf(stderr, "BottleneckIndex allocation failed!\n");
+        bottleneck_index_free(index);
+        return NULL;
+    }
+    return index;
+}
+
+void bottleneck_index_free(BottleneckIndex *index) {
+    if (index) {
+        free(index->position);
+        free(index->component);
+        free(index->gap);
+        free(index->table);
+        free(index);
+    }
+}
+
+bool bottleneck_query(const BottleneckIndex *index, int u, int v, int *weight) {
+    if (index->component[u] != index->component[v]) {
+        return false;
+    }
+    if (u == v) {
+        *weight = INT_MIN;
+        return true;
+    }
+    int pu = index->position[u];
+    int pv = index->position[v];
+    *weight = pu < pv ? range_max(index, pu, pv - 1) : range_max(index, pv, pu - 1);
+    return true;
+}
+
+#define BOTTLENECK_PREFETCH_DISTANCE 16
+
+void bottleneck_query_batch(const BottleneckIndex *index, const int u[], const int v[], size_t count,
+                            int weights[], bool connected[]) {
+    for (size_t i = 0; i < count; i++) {
+        if (i + BOTTLENECK_PREFETCH_DISTANCE < count) {
+            size_t j = i + BOTTLENECK_PREFETCH_DISTANCE;
+            __builtin_prefetch(&index->position[u[j]]);
+            __builtin_prefetch(&index->position[v[j]]);
+            __builtin_prefetch(&index->component[u[j]]);
+            __builtin_prefetch(&index->component[v[j]]);
+        }
+        bool found = bottleneck_query(index, u[i], v[i], &weights[i]);
+        if (connected) {
+            connected[i] = found;
+        }
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ *  Bottleneck (minimax) path queries over a minimum spanning forest.
+ */
+
+#ifndef TEMPLATE_BOTTLENECK_INDEX_H
+#define TEMPLATE_BOTTLENECK_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "MinCostSpanninTree.h"
+
+typedef struct BottleneckIndex BottleneckIndex;
+
+/**
+ * @brief Builds a query index over a minimum spanning forest, O(V log V / 32) extra memory.
+ * * Typically fed with the output of kruskal_mcst_forest. Edges that would
+ * close a cycle are ignored.
+ * @param num_vertices The number of vertices (0 to num_vertices-1).
+ * @param forest The forest edges, in any order.
+ * @param num_forest_edges The number of forest edges.
+ * @return BottleneckIndex* The index, or NULL on failure.
+ */
+BottleneckIndex *bottleneck_index_new(int num_vertices, const Edge forest[], int num_forest_edges);
+/**
+ * @brief Frees all memory associated with the index.
+ */
+void bottleneck_index_free(BottleneckIndex *index);
+/**
+ * @brief Finds the heaviest edge weight on the forest path between u and v, O(1).
+ * * For u == v the path is empty and the weight is INT_MIN.
+ * @param weight Receives the bottleneck weight when u and v are connected.
+ * @return bool true if u and v are in the same tree, false otherwise.
+ */
+bool bottleneck_query(const BottleneckIndex *index, int u, int v, int *weight);
+/**
+ * @brief Answers 'count' queries (u[i], v[i]) at once, prefetching ahead to overlap cache misses.
+ * @param weights Receives the bottleneck weight of each connected pair.
+ * @param connected Receives whether each pair is connected (may be NULL).
+ */
+void bottleneck_query_batch(const BottleneckIndex *index, const int u[], const int v[], size_t count,
+                            int weights[], bool connected[]);
+
+#endif //TEMPLATE_BOTTLENECK_INDEX_H
@@ -0,0 +1,306 @@
+/*
+ *  Incremental minimum spanning forest with a link-cut tree (Sleator & Tarjan).
+ *
+ *  Every vertex and every edge is a node of the link-cut tree; a tree edge
+ *  (u, v) is represented by the path u - e - v. Vertex nodes carry weight
+ *  INT_MIN, so the path aggregate "node of maximum weight" always names an
+ *  edge. Each splay tree keeps that aggregate for its subtree.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "dynamic_mst.h"
+
+#define LCT_NIL (-1)
+
+typedef struct {
+    int child[2];
+    int parent;     ///< Splay parent, or path-parent if this node is a splay root.
+    int weight;
+    int max_node;   ///< Node of maximum weight in this splay subtree.
+    int reversed;   ///< Lazy flag: the children of this subtree must be swapped.
+} LCTNode;
+
+typedef struct {
+    int u, v;
+    int weight;
+    int in_tree;
+} DynamicEdge;
+
+struct DynamicMST {
+    int num_vertices;
+    LCTNode *nodes;     ///< Vertex nodes first, then one node per edge.
+    int *stack;         ///< Scratch stack for pushing lazy flags before a splay.
+    DynamicEdge *edges;
+    int num_edges;
+    int edge_capacity;
+    long long cost;
+    int tree_edges;
+};
+
+// --- Link-Cut Tree ---
+
+static inline int is_splay_root(const LCTNode *t, int x) {
+    int p = t[x].parent;
+    return p == LCT_NIL || (t[p].child[0] != x && t[p].child[1] != x);
+}
+
+static inline void push_down(LCTNode *t, int x) {
+    if (t[x].reversed) {
+        int left = t[x].child[0];
+        t[x].child[0] = t[x].child[1];
+        t[x].child[1] = left;
+        if (t[x].child[0] != LCT_NIL) t[t[x].child[0]].reversed ^= 1;
+        if (t[x].child[1] != LCT_NIL) t[t[x].child[1]].reversed ^= 1;
+        t[x].reversed = 0;
+    }
+}
+
+static inline void pull_up(LCTNode *t, int x) {
+    int best = x;
+    for (int side = 0; side < 2; side++) {
+        int c = t[x].child[side];
+        if (c != LCT_NIL && t[t[c].max_node].weight > t[best].weight) {
+            best = t[c].max_node;
+        }
+    }
+    t[x].max_node = best;
+}
+
+static void rotate(LCTNode *t, int x) {
+    int p = t[x].parent;
+    int g = t[p].parent;
+    int side = t[p].child[1] == x;
+
+    if (!is_splay_root(t, p)) {
+        t[g].child[t[g].child[1] == p] = x;
+    }
+    t[x].parent = g;
+
+    t[p].child[side] = t[x].child[!side];
+    if (t[x].child[!side] != LCT_NIL) {
+        t[t[x].child[!side]].parent = p;
+    }
+    t[x].child[!side] = p;
+    t[p].parent = x;
+
+    pull_up(t, p);
+    pull_up(t, x);
+}
+
+static void splay(DynamicMST *mst, int x) {
+    LCTNode *t = mst->nodes;
+
+    // Push lazy reversals from the splay root down to x first (iteratively, splay trees can be deep).
+    int top = 0;
+    mst->stack[top++] = x;
+    for (int y = x; !is_splay_root(t, y); y = t[y].parent) {
+        mst->stack[top++] = t[y].parent;
+    }
+    while (top > 0) {
+        push_down(t, mst->stack[--top]);
+    }
+
+    while (!is_splay_root(t, x)) {
+        int p = t[x].parent;
+        if (!is_splay_root(t, p)) {
+            int g = t[p].parent;
+            int zig_zig = (t[g].child[1] == p) == (t[p].child[1] == x);
+            rotate(t, zig_zig ? p : x);
+        }
+        rotate(t, x);
+    }
+}
+
+/**
+ * @brief Makes the root-to-x path preferred; x ends up as the root of its splay tree.
+ */
+static void access(DynamicMST *mst, int x) {
+    LCTNode *t = mst->nodes;
+    int last = LCT_NIL;
+    for (int y = x; y != LCT_NIL; y = t[y].parent) {
+        splay(mst, y);
+        t[y].child[1] = last;
+        pull_up(t, y);
+        last = y;
+    }
+    splay(mst, x);
+}
+
+static void make_root(DynamicMST *mst, int x) {
+    access(mst, x);
+    mst->nodes[x].reversed ^= 1;
+}
+
+static int find_root(DynamicMST *mst, int x) {
+    LCTNode *t = mst->nodes;
+    access(mst, x);
+    push_down(t, x);
+    while (t[x].child[0] != LCT_NIL) {
+        x = t[x].child[0];
+        push_down(t, x);
+    }
+    splay(mst, x);
+    return x;
+}
+
+static void link(DynamicMST *mst, int x, int y) {
+    make_root(mst, x);
+    mst->nodes[x].parent = y;
+}
+
+static void cut(DynamicMST *mst, int x, int y) {
+    LCTNode *t = mst->nodes;
+    make_root(mst, x);
+    access(mst, y);
+    // The path is exactly x - y, so x is y's left child.
+    t[y].child[0] = LCT_NIL;
+    t[x].parent = LCT_NIL;
+    pull_up(t, y);
+}
+
+/**
+ * @brief Returns the node of maximum weight on the tree path between u and v.
+ */
+static int path_max(DynamicMST *mst, int u, int v) {
+    make_root(mst, u);
+    access(mst, v);
+    return mst->nodes[v].max_node;
+}
+
+// --- Public API ---
+
+DynamicMST *dmst_new(int num_vertices) {
+    if (num_vertices <= 0) {
+        fprintf(stderr, "DynamicMST size must be greater than 0!\n");
+        return NULL;
+    }
+    DynamicMST *mst = malloc(sizeof(DynamicMST));
+    if (!mst) {
+        fprintf(stderr, "DynamicMST allocation failed!\n");
+        return NULL;
+    }
+
+    int capacity = 16;
+    mst->nodes = malloc(sizeof(LCTNode) * ((size_t)num_vertices + capacity));
+    mst->stack = malloc(sizeof(int) * ((size_t)num_vertices + capacity));
+    mst->edges = malloc(sizeof(DynamicEdge) * capacity);
+    if (!mst->nodes || !mst->stack || !mst->edges) {
+        fprintf(stderr, "DynamicMST allocation failed!\n");
+        dmst_free(mst);
+        return NULL;
+    }
+    for (int i = 0; i < num_vertices; i++) {
+        mst->nodes[i] = (LCTNode){{LCT_NIL, LCT_NIL}, LCT_NIL, INT_MIN, i, 0};
+    }
+    mst->num_vertices = num_vertices;
+    mst->num_edges = 0;
+    mst->edge_capacity = capacity;
+    mst->cost = 0;
+    mst->tree_edges = 0;
+    return mst;
+}
+
+void dmst_free(DynamicMST *mst) {
+    if (mst) {
+        free(mst->nodes);
+        free(mst->stack);
+        free(mst->edges);
+        free(mst);
+    }
+}
+
+/**
+ * @brief Offers non-tree edge 'id' (with its current weight) to the forest.
+ */
+static void offer_edge(DynamicMST *mst, int id) {
+    DynamicEdge *e = &mst->edges[id];
+    int node = mst->num_vertices + id;
+    if (e->u == e->v) {
+        return; // self-loops never join a spanning forest
+    }
+
+    if (find_root(mst, e->u) == find_root(mst, e->v)) {
+        int heaviest = path_max(mst, e->u, e->v);
+        if (mst->nodes[heaviest].weight <= e->weight) {
+            return;
+        }
+        // Swap out the heaviest edge on the cycle.
+        DynamicEdge *old = &mst->edges[heaviest - mst->num_vertices];
+        cut(mst, old->u, heaviest);
+        cut(mst, heaviest, old->v);
+        old->in_tree = 0;
+        mst->cost -= old->weight;
+        mst->tree_edges--;
+    }
+
+    link(mst, e->u, node);
+    link(mst, node, e->v);
+    e->in_tree = 1;
+    mst->cost += e->weight;
+    mst->tree_edges++;
+}
+
+int dmst_insert_edge(DynamicMST *mst, int u, int v, int weight) {
+    if (u < 0 || v < 0 || u >= mst->num_vertices || v >= mst->num_vertices) {
+        return -1;
+    }
+    if (mst->num_edges == mst->edge_capacity) {
+        int new_capacity = mst->edge_capacity * 2;
+        size_t num_nodes = (size_t)mst->num_vertices + new_capacity;
+        LCTNode *nodes = realloc(mst->nodes, sizeof(LCTNode) * num_nodes);
+        if (nodes) mst->nodes = nodes;
+        int *stack = realloc(mst->stack, sizeof(int) * num_nodes);
+        if (stack) mst->stack = stack;
+        DynamicEdge *edges = realloc(mst->edges, sizeof(DynamicEdge) * new_capacity);
+        if (edges) mst->edges = edges;
+        if (!nodes || !stack || !edges) {
+            fprintf(stderr, "DynamicMST edge allocation failed!\n");
+            return -1;
+        }
+        mst->edge_capacity = new_capacity;
+    }
+
+    int id = mst->num_edges++;
+    int node = mst->num_vertices + id;
+    mst->nodes[node] = (LCTNode){{LCT_NIL, LCT_NIL}, LCT_NIL, weight, node, 0};
+    mst->edges[id] = (DynamicEdge){u, v, weight, 0};
+    offer_edge(mst, id);
+    return id;
+}
+
+int dmst_decrease_weight(DynamicMST *mst, int edge_id, int new_weight) {
+    if (edge_id < 0 || edge_id >= mst->num_edges || new_weight > mst->edges[edge_id].weight) {
+        return -1;
+    }
+    DynamicEdge *e = &mst->edges[edge_id];
+    int node = mst->num_vertices + edge_id;
+
+    if (e->in_tree) {
+        // A cheaper tree edge keeps the tree minimal; only the aggregates change.
+        mst->cost -= (long long)e->weight - new_weight;
+        e->weight = new_weight;
+        access(mst, node);
+        mst->nodes[node].weight = new_weight;
+        pull_up(mst->nodes, node);
+    } else {
+        e->weight = new_weight;
+        mst->nodes[node].weight = new_weight;
+        offer_edge(mst, edge_id);
+    }
+    return 0;
+}
+
+long long dmst_cost(const DynamicMST *mst) {
+    return mst->cost;
+}
+
+int dmst_num_tree_edges(const DynamicMST *mst) {
+    return mst->tree_edges;
+}
+
+int dmst_in_tree(const DynamicMST *mst, int edge_id) {
+    return edge_id >= 0 && edge_id < mst->num_edges && mst->edges[edge_id].in_tree;
+}
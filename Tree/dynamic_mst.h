@@ -0,0 +1,48 @@
+/*
+ *  Incremental minimum spanning forest maintained with a link-cut tree.
+ */
+
+#ifndef TEMPLATE_DYNAMIC_MST_H
+#define TEMPLATE_DYNAMIC_MST_H
+
+typedef struct DynamicMST DynamicMST;
+
+/**
+ * @brief Creates an empty minimum spanning forest over 'num_vertices' isolated vertices.
+ * @return DynamicMST* The new structure, or NULL on failure.
+ */
+DynamicMST *dmst_new(int num_vertices);
+/**
+ * @brief Frees all memory associated with the structure.
+ */
+void dmst_free(DynamicMST *mst);
+/**
+ * @brief Inserts the edge (u, v, weight), O(log n) amortized.
+ * * If u and v are already connected, the heaviest edge on the tree path
+ * between them is found with the link-cut tree and swapped out when the new
+ * edge is cheaper; otherwise the new edge links the two trees.
+ * @return int The id of the new edge (0, 1, 2, ... in insertion order), or -1 on failure.
+ */
+int dmst_insert_edge(DynamicMST *mst, int u, int v, int weight);
+/**
+ * @brief Lowers the weight of edge 'edge_id' to 'new_weight', O(log n) amortized.
+ * * A tree edge stays in the tree; a non-tree edge is offered to the forest
+ * again exactly like an insertion.
+ * @return int 0 on success, -1 if the id is invalid or the weight would increase.
+ */
+int dmst_decrease_weight(DynamicMST *mst, int edge_id, int new_weight);
+/**
+ * @brief Returns the total weight of the current minimum spanning forest, O(1).
+ */
+long long dmst_cost(const DynamicMST *mst);
+/**
+ * @brief Returns the number of edges in the current spanning forest, O(1).
+ * The forest is a spanning tree when this equals num_vertices - 1.
+ */
+int dmst_num_tree_edges(const DynamicMST *mst);
+/**
+ * @brief Returns 1 if edge 'edge_id' is currently in the spanning forest, 0 otherwise.
+ */
+int dmst_in_tree(const DynamicMST *mst, int edge_id);
+
+#endif //TEMPLATE_DYNAMIC_MST_H
@@ -0,0 +1,91 @@
+/*
+ *  Benchmark: incremental DynamicMST updates against recomputing Kruskal from scratch.
+ *  Usage: dynamic-mst-bench [num_vertices] [initial_edges] [updates]
+ *         (default: 100k vertices, 1M initial edges, 1M updates)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "MinCostSpanninTree.h"
+#include "dynamic_mst.h"
+#include "../bench_util.h"
+
+#define NUM_CHECKPOINTS 5
+
+int main(int argc, char *argv[]) {
+    int num_vertices = argc > 1 ? atoi(argv[1]) : 100000;
+    int initial_edges = argc > 2 ? atoi(argv[2]) : 1000000;
+    int updates = argc > 3 ? atoi(argv[3]) : 1000000;
+    if (initial_edges < num_vertices - 1) initial_edges = num_vertices - 1;
+
+    // The edge list mirrors the dynamic structure so Kruskal can recompute from scratch.
+    int capacity = initial_edges + updates;
+    Edge *edges = malloc(sizeof(Edge) * capacity);
+    Edge *work = malloc(sizeof(Edge) * capacity);
+    DynamicMST *mst = dmst_new(num_vertices);
+    if (!edges || !work || !mst) {
+        fprintf(stderr, "Allocation failed!\n");
+        return 1;
+    }
+
+    uint64_t state = 2024;
+    int num_edges = 0;
+    double start = now_sec();
+    for (int i = 0; i < initial_edges; i++) {
+        // A path first keeps the graph connected.
+        int u = i < num_vertices - 1 ? i : (int)(next_rand(&state) % num_vertices);
+        int v = i < num_vertices - 1 ? i + 1 : (int)(next_rand(&state) % num_vertices);
+        int w = (int)(next_rand(&state) % 1000000000);
+        edges[num_edges++] = (Edge){u, v, w};
+        dmst_insert_edge(mst, u, v, w);
+    }
+    printf("V=%d  built from %d edges in %.3f s\n", num_vertices, initial_edges, now_sec() - start);
+
+    double dynamic_time = 0;
+    double recompute_time = 0;
+    int mismatches = 0;
+    int interval = updates / NUM_CHECKPOINTS > 0 ? updates / NUM_CHECKPOINTS : 1;
+
+    for (int q = 0; q < updates; q++) {
+        start = now_sec();
+        if (next_rand(&state) % 2) {
+            int u = (int)(next_rand(&state) % num_vertices);
+            int v = (int)(next_rand(&state) % num_vertices);
+            int w = (int)(next_rand(&state) % 1000000000);
+            edges[num_edges++] = (Edge){u, v, w};
+            dmst_insert_edge(mst, u, v, w);
+        } else {
+            int id = (int)(next_rand(&state) % num_edges);
+            int w = edges[id].weight / 2;
+            edges[id].weight = w;
+            dmst_decrease_weight(mst, id, w);
+        }
+        dynamic_time += now_sec() - start;
+
+        if ((q + 1) % interval == 0) {
+            memcpy(work, edges, sizeof(Edge) * num_edges);
+            start = now_sec();
+            long long cost = kruskal_mcst(num_vertices, work, num_edges);
+            recompute_time += now_sec() - start;
+            if (cost != dmst_cost(mst)) mismatches++;
+        }
+    }
+
+    int checkpoints = updates / interval;
+    double per_update = dynamic_time / updates;
+    double per_recompute = checkpoints > 0 ? recompute_time / checkpoints : 0;
+    printf("dynamic update:     %.3f us / update (%d updates)\n", per_update * 1e6, updates);
+    printf("Kruskal recompute:  %.3f ms / update (%d samples)  -> %.0fx%s\n", per_recompute * 1e3,
+           checkpoints, per_update > 0 ? per_recompute / per_update : 0,
+           mismatches ? "  COST MISMATCH" : "");
+
+    dmst_free(mst);
+    free(edges);
+    free(work);
+    return 0;
+}
@@ -0,0 +1,370 @@
+/*
+ *  External-memory Kruskal: sorted runs on disk, k-way merged into a resident DSU.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#include "external_kruskal.h"
+#include "graph_file.h"
+#include "../DSU/DSU.h"
+
+#define EXT_MIN_BUDGET ((size_t)1 << 20)  ///< Smallest accepted memory budget (1 MiB).
+#define EXT_MIN_BLOCK_EDGES 4096          ///< Smallest read buffer per run while merging.
+
+/**
+ * @brief A sorted run stored in a temporary file.
+ */
+typedef struct {
+    FILE *file;
+    uint64_t num_edges;
+} Run;
+
+/**
+ * @brief Buffered sequential reader over one run during a merge.
+ */
+typedef struct {
+    FILE *file;
+    Edge *buffer;
+    size_t capacity;
+    size_t size;
+    size_t next;
+    uint64_t remaining; ///< Edges of the run not read into the buffer yet.
+} RunReader;
+
+/**
+ * @brief Destination of a merge: either another run file or the final Kruskal scan.
+ */
+typedef struct {
+    FILE *out;          ///< Run file being written, or NULL for the Kruskal scan.
+    Edge *out_buffer;
+    size_t out_capacity;
+    size_t out_size;
+    uint64_t written;
+    DSU *dsu;
+    long long min_cost;
+    int edges_in_mst;
+    int target;         ///< num_vertices - 1.
+} MergeSink;
+
+/**
+ * @brief Creates an anonymous temporary file; it is deleted automatically when closed.
+ */
+static FILE *create_temp(const char *tmp_dir) {
+    if (!tmp_dir) {
+        return tmpfile();
+    }
+    size_t length = strlen(tmp_dir) + sizeof("/mcst-run-XXXXXX");
+    char *path = malloc(length);
+    if (!path) return NULL;
+    snprintf(path, length, "%s/mcst-run-XXXXXX", tmp_dir);
+    int fd = mkstemp(path);
+    FILE *file = NULL;
+    if (fd >= 0) {
+        unlink(path);
+        file = fdopen(fd, "w+b");
+        if (!file) close(fd);
+    }
+    free(path);
+    return file;
+}
+
+/**
+ * @brief Makes sure the reader has a current edge.
+ * @return int 1 if an edge is available, 0 at the end of the run, -1 on a read error.
+ */
+static int reader_fill(RunReader *reader) {
+    if (reader->next < reader->size) {
+        return 1;
+    }
+    if (reader->remaining == 0) {
+        return 0;
+    }
+    size_t want = reader->remaining < reader->capacity ? (size_t)reader->remaining : reader->capacity;
+    if (fread(reader->buffer, sizeof(Edge), want, reader->file) != want) {
+        return -1;
+    }
+    reader->size = want;
+    reader->next = 0;
+    reader->remaining -= want;
+    return 1;
+}
+
+/**
+ * @brief Passes one edge to the sink.
+ * @return int 1 to continue, 0 if the MCST is complete, -1 on a write error.
+ */
+static int sink_push(MergeSink *sink, Edge edge) {
+    if (sink->out) {
+        sink->out_buffer[sink->out_size++] = edge;
+        if (sink->out_size == sink->out_capacity) {
+            if (fwrite(sink->out_buffer, sizeof(Edge), sink->out_size, sink->out) != sink->out_size) {
+                return -1;
+            }
+            sink->written += sink->out_size;
+            sink->out_size = 0;
+        }
+        return 1;
+    }
+    if (dsu_union(sink->dsu, edge.u, edge.v) > 0) {
+        sink->min_cost += edge.weight;
+        sink->edges_in_mst++;
+    }
+    return sink->edges_in_mst < sink->target;
+}
+
+static int sink_flush(MergeSink *sink) {
+    if (sink->out && sink->out_size > 0) {
+        if (fwrite(sink->out_buffer, sizeof(Edge), sink->out_size, sink->out) != sink->out_size) {
+            return -1;
+        }
+        sink->written += sink->out_size;
+        sink->out_size = 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief Restores the min-heap of reader indices (keyed by their current edge weight) below position i.
+ */
+static void merge_sift_down(int *heap, int size, const RunReader *readers, int i) {
+    int item = heap[i];
+    int key = readers[item].buffer[readers[item].next].weight;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= size) break;
+        int child_key = readers[heap[child]].buffer[readers[heap[child]].next].weight;
+        if (child + 1 < size) {
+            int right_key = readers[heap[child + 1]].buffer[readers[heap[child + 1]].next].weight;
+            if (right_key < child_key) {
+                child++;
+                child_key = right_key;
+            }
+        }
+        if (key <= child_key) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = item;
+}
+
+/**
+ * @brief k-way merges runs[0..k) in weight order into the sink.
+ * * The edge buffer budget is split evenly between the k readers and, when
+ * writing a new run, the output buffer.
+ * @return int 0 on success (including an early stop once the MCST is complete), -1 on error.
+ */
+static int merge_runs(Run *runs, int k, size_t budget_edges, MergeSink *sink) {
+    size_t parts = (size_t)k + (sink->out ? 1 : 0);
+    size_t block = budget_edges / parts;
+    Edge *memory = malloc(sizeof(Edge) * block * parts);
+    RunReader *readers = malloc(sizeof(RunReader) * k);
+    int *heap = malloc(sizeof(int) * k);
+    if (!memory || !readers || !heap) {
+        free(memory);
+        free(readers);
+        free(heap);
+        return -1;
+    }
+
+    int status = 0;
+    int heap_size = 0;
+    for (int r = 0; r < k; r++) {
+        rewind(runs[r].file);
+        readers[r] = (RunReader){runs[r].file, memory + block * r, block, 0, 0, runs[r].num_edges};
+        int filled = reader_fill(&readers[r]);
+        if (filled < 0) status = -1;
+        if (filled > 0) heap[heap_size++] = r;
+    }
+    if (sink->out) {
+        sink->out_buffer = memory + block * k;
+        sink->out_capacity = block;
+        sink->out_size = 0;
+        sink->written = 0;
+    }
+    for (int i = heap_size / 2 - 1; i >= 0; i--) {
+        merge_sift_down(heap, heap_size, readers, i);
+    }
+
+    while (status == 0 && heap_size > 0) {
+        RunReader *top = &readers[heap[0]];
+        int pushed = sink_push(sink, top->buffer[top->next++]);
+        if (pushed <= 0) {
+            status = pushed;
+            break;
+        }
+        int filled = reader_fill(top);
+        if (filled < 0) {
+            status = -1;
+            break;
+        }
+        if (filled == 0) {
+            heap[0] = heap[--heap_size];
+        }
+        if (heap_size > 0) {
+            merge_sift_down(heap, heap_size, readers, 0);
+        }
+    }
+    if (status == 0) {
+        status = sink_flush(sink);
+    }
+
+    free(memory);
+    free(readers);
+    free(heap);
+    return status;
+}
+
+/**
+ * @brief Reads and checks the header of a graph file, leaving the stream at the edge list.
+ */
+static int open_edge_list(FILE *in, GraphFileHeader *header) {
+    if (fread(header, sizeof(*header), 1, in) != 1 ||
+        memcmp(header->magic, GRAPH_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != GRAPH_FILE_VERSION ||
+        header->num_vertices == 0 || header->num_vertices > INT_MAX ||
+        header->edges_offset == 0) {
+        return -1;
+    }
+    return fseeko(in, (off_t)header->edges_offset, SEEK_SET);
+}
+
+long long external_kruskal_mcst(const char *graph_path, size_t memory_budget, const char *tmp_dir) {
+    FILE *in = fopen(graph_path, "rb");
+    if (!in) {
+        fprintf(stderr, "Error: cannot open %s\n", graph_path);
+        return -1;
+    }
+    GraphFileHeader header;
+    if (open_edge_list(in, &header) != 0) {
+        fprintf(stderr, "Error: %s is not a graph file with an edge list\n", graph_path);
+        fclose(in);
+        return -1;
+    }
+
+    int num_vertices = (int)header.num_vertices;
+    DSU *dsu = dsu_new(num_vertices);
+    if (!dsu) {
+        fclose(in);
+        return -1;
+    }
+
+    if (memory_budget < EXT_MIN_BUDGET) {
+        memory_budget = EXT_MIN_BUDGET;
+    }
+    size_t budget_edges = memory_budget / sizeof(Edge);
+    size_t run_edges = budget_edges / 2; // radix_sort_edges needs an equally large scratch buffer
+    if (run_edges > INT_MAX) run_edges = INT_MAX; // radix_sort_edges takes an int count
+    int max_fan_in = (int)(budget_edges / EXT_MIN_BLOCK_EDGES) - 1;
+    if (max_fan_in < 2) max_fan_in = 2;
+
+    MergeSink sink = {NULL, NULL, 0, 0, 0, dsu, 0, 0, num_vertices - 1};
+    Edge *buffer = malloc(sizeof(Edge) * run_edges);
+    Run *runs = NULL;
+    int num_runs = 0;
+    int runs_capacity = 0;
+    int status = buffer ? 0 : -1;
+
+    // Phase 1: sorted runs. A graph that fits in a single run never touches the disk.
+    uint64_t remaining = header.num_edges;
+    while (status == 0 && remaining > 0) {
+        size_t count = remaining < run_edges ? (size_t)remaining : run_edges;
+        if (fread(buffer, sizeof(Edge), count, in) != count) {
+            fprintf(stderr, "Error: %s is truncated\n", graph_path);
+            status = -1;
+            break;
+        }
+        remaining -= count;
+        for (size_t i = 0; i < count; i++) {
+            if (buffer[i].u < 0 || buffer[i].u >= num_vertices ||
+                buffer[i].v < 0 || buffer[i].v >= num_vertices) {
+                fprintf(stderr, "Error: %s is not a valid graph file\n", graph_path);
+                status = -1;
+                break;
+            }
+        }
+        if (status != 0) {
+            break;
+        }
+        radix_sort_edges(buffer, (int)count);
+
+        if (num_runs == 0 && remaining == 0) {
+            for (size_t i = 0; i < count && sink_push(&sink, buffer[i]) > 0; i++) {
+            }
+            break;
+        }
+
+        if (num_runs == runs_capacity) {
+            runs_capacity = runs_capacity ? runs_capacity * 2 : 16;
+            Run *grown = realloc(runs, sizeof(Run) * runs_capacity);
+            if (!grown) {
+                status = -1;
+                break;
+            }
+            runs = grown;
+        }
+        FILE *file = create_temp(tmp_dir);
+        if (!file || fwrite(buffer, sizeof(Edge), count, file) != count) {
+            fprintf(stderr, "Error: cannot write a temporary run file\n");
+            if (file) fclose(file);
+            status = -1;
+            break;
+        }
+        runs[num_runs++] = (Run){file, count};
+    }
+    fclose(in);
+    free(buffer);
+
+    // Phase 2: merge passes until the runs fit into one final merge.
+    while (status == 0 && num_runs > max_fan_in) {
+        int merged_runs = 0;
+        for (int first = 0; status == 0 && first < num_runs; first += max_fan_in) {
+            int k = num_runs - first < max_fan_in ? num_runs - first : max_fan_in;
+            MergeSink to_file = {create_temp(tmp_dir), NULL, 0, 0, 0, NULL, 0, 0, 0};
+            if (!to_file.out || merge_runs(runs + first, k, budget_edges, &to_file) != 0) {
+                fprintf(stderr, "Error: merge pass failed\n");
+                if (to_file.out) fclose(to_file.out);
+                status = -1;
+                break;
+            }
+            for (int r = first; r < first + k; r++) {
+                fclose(runs[r].file);
+                runs[r].file = NULL;
+            }
+            runs[merged_runs++] = (Run){to_file.out, to_file.written};
+        }
+        if (status != 0) {
+            // Keep the still-open input runs after the merged ones so the cleanup below closes them.
+            for (int r = merged_runs; r < num_runs; r++) {
+                if (runs[r].file) {
+                    runs[merged_runs++] = runs[r];
+                }
+            }
+        }
+        num_runs = merged_runs;
+    }
+
+    // Phase 3: final merge straight into the DSU.
+    if (status == 0 && num_runs > 0 && merge_runs(runs, num_runs, budget_edges, &sink) != 0) {
+        fprintf(stderr, "Error: final merge failed\n");
+        status = -1;
+    }
+
+    for (int r = 0; r < num_runs; r++) {
+        fclose(runs[r].file);
+    }
+    free(runs);
+    dsu_free(dsu);
+
+    if (status == 0 && sink.edges_in_mst == sink.target) {
+        return sink.min_cost;
+    } else {
+        return -1;
+    }
+}
@@ -0,0 +1,26 @@
+/*
+ *  External-memory Kruskal for edge lists larger than RAM.
+ */
+
+#ifndef TEMPLATE_EXTERNAL_KRUSKAL_H
+#define TEMPLATE_EXTERNAL_KRUSKAL_H
+
+#include <stddef.h>
+
+/**
+ * @brief Computes the MCST cost of the edge list stored in a graph file
+ * (see graph_file.h) without ever holding the whole list in memory.
+ * * Edges are read sequentially in runs that fit the budget, each run is
+ * radix-sorted and written to a temporary file, and the runs are k-way merged
+ * in weight order straight into a resident DSU over the vertices. If there are
+ * more runs than the budget allows to merge at once, they are merged in
+ * several passes. All disk I/O is sequential.
+ * @param graph_path The graph file; it must contain the edge list section.
+ * @param memory_budget Bytes available for edge buffers (the DSU's 4 bytes per
+ * vertex come on top). Small values are raised to a minimum of 1 MiB.
+ * @param tmp_dir Directory for the temporary run files, or NULL for the system default.
+ * @return long long The MCST cost, or -1 if the graph is disconnected or an error occurred.
+ */
+long long external_kruskal_mcst(const char *graph_path, size_t memory_budget, const char *tmp_dir);
+
+#endif //TEMPLATE_EXTERNAL_KRUSKAL_H
@@ -0,0 +1,313 @@
+/*
+ *  Binary graph files: writer, text converter and mmap loader.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "graph_file.h"
+
+#define GRAPH_FILE_ALIGN 64
+
+_Static_assert(sizeof(int) == 4, "graph files store int as 32-bit");
+_Static_assert(sizeof(Edge) == 12, "Edge must be three packed 32-bit ints");
+_Static_assert(sizeof(GraphFileHeader) == 72, "unexpected GraphFileHeader padding");
+
+struct GraphFile {
+    void *base;       ///< Start of the mapping.
+    size_t length;    ///< Length of the mapping in bytes.
+    int num_vertices;
+    int num_edges;
+    Edge *edges;      ///< NULL if absent.
+    CSRGraph csr;
+    int has_csr;
+};
+
+// --- Writing ---
+
+static uint64_t align_up(uint64_t x) {
+    return (x + GRAPH_FILE_ALIGN - 1) / GRAPH_FILE_ALIGN * GRAPH_FILE_ALIGN;
+}
+
+/**
+ * @brief Writes 'size' bytes at byte 'offset', zero-padding from the current position.
+ */
+static int write_section(FILE *out, uint64_t *position, uint64_t offset, const void *data, size_t size) {
+    static const char zeros[GRAPH_FILE_ALIGN] = {0};
+    while (*position < offset) {
+        size_t pad = (size_t)(offset - *position);
+        if (pad > sizeof(zeros)) pad = sizeof(zeros);
+        if (fwrite(zeros, 1, pad, out) != pad) return -1;
+        *position += pad;
+    }
+    if (size > 0 && fwrite(data, 1, size, out) != size) return -1;
+    *position += size;
+    return 0;
+}
+
+int graph_file_write(const char *path, int num_vertices, const Edge edges[], int num_edges,
+                     int with_edges, int with_csr) {
+    CSRGraph *csr = NULL;
+    if (with_csr) {
+        csr = csr_from_edges(num_vertices, edges, num_edges);
+        if (!csr) return -1;
+    }
+
+    GraphFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic));
+    header.version = GRAPH_FILE_VERSION;
+    header.num_vertices = (uint64_t)num_vertices;
+    header.num_edges = (uint64_t)num_edges;
+
+    uint64_t end = align_up(sizeof(GraphFileHeader));
+    if (with_edges) {
+        header.edges_offset = end;
+        end = align_up(end + sizeof(Edge) * (uint64_t)num_edges);
+    }
+    if (csr) {
+        header.num_arcs = csr->num_arcs;
+        header.offsets_offset = end;
+        end = align_up(end + sizeof(uint64_t) * ((uint64_t)num_vertices + 1));
+        header.targets_offset = end;
+        end = align_up(end + sizeof(int) * csr->num_arcs);
+        header.weights_offset = end;
+    }
+
+    FILE *out = fopen(path, "wb");
+    if (!out) {
+        fprintf(stderr, "Error: cannot create %s\n", path);
+        csr_free(csr);
+        return -1;
+    }
+    uint64_t position = 0;
+    int status = write_section(out, &position, 0, &header, sizeof(header));
+    if (status == 0 && with_edges) {
+        status = write_section(out, &position, header.edges_offset, edges, sizeof(Edge) * (size_t)num_edges);
+    }
+    if (status == 0 && csr) {
+        status = write_section(out, &position, header.offsets_offset, csr->offsets,
+                               sizeof(uint64_t) * ((size_t)num_vertices + 1));
+    }
+    if (status == 0 && csr) {
+        status = write_section(out, &position, header.targets_offset, csr->targets, sizeof(int) * csr->num_arcs);
+    }
+    if (status == 0 && csr) {
+        status = write_section(out, &position, header.weights_offset, csr->weights, sizeof(int) * csr->num_arcs);
+    }
+    if (fclose(out) != 0) {
+        status = -1;
+    }
+    if (status != 0) {
+        fprintf(stderr, "Error: failed writing %s\n", path);
+    }
+    csr_free(csr);
+    return status;
+}
+
+int graph_file_convert_text(const char *text_path, const char *out_path) {
+    FILE *in = fopen(text_path, "r");
+    if (!in) {
+        fprintf(stderr, "Error: cannot open %s\n", text_path);
+        return -1;
+    }
+
+    size_t capacity = 1024;
+    size_t num_edges = 0;
+    Edge *edges = (Edge *)malloc(sizeof(Edge) * capacity);
+    long max_vertex = -1;
+    char *line = NULL;          // getline grows it, so long lines are never split
+    size_t line_capacity = 0;
+    long line_number = 0;
+    int status = edges ? 0 : -1;
+
+    while (status == 0 && getline(&line, &line_capacity, in) != -1) {
+        line_number++;
+        char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '#' || *p == '%' || *p == '\n' || *p == '\r' || *p == '\0') {
+            continue;
+        }
+
+        char *end_u, *end_v, *end_w;
+        long u = strtol(p, &end_u, 10);
+        long v = strtol(end_u, &end_v, 10);
+        long w = strtol(end_v, &end_w, 10);
+        if (end_u == p || end_v == end_u || end_w == end_v ||
+            u < 0 || v < 0 || u >= INT_MAX || v >= INT_MAX || w < INT_MIN || w > INT_MAX) {
+            fprintf(stderr, "Error: %s:%ld: expected \"u v weight\"\n", text_path, line_number);
+            status = -1;
+            break;
+        }
+        if (num_edges == INT_MAX) {
+            fprintf(stderr, "Error: %s has more than INT_MAX edges\n", text_path);
+            status = -1;
+            break;
+        }
+
+        if (num_edges == capacity) {
+            Edge *grown = (Edge *)realloc(edges, sizeof(Edge) * capacity * 2);
+            if (!grown) {
+                status = -1;
+                break;
+            }
+            edges = grown;
+            capacity *= 2;
+        }
+        edges[num_edges++] = (Edge){(int)u, (int)v, (int)w};
+        if (u > max_vertex) max_vertex = u;
+        if (v > max_vertex) max_vertex = v;
+    }
+    free(line);
+    fclose(in);
+
+    if (status == 0 && num_edges == 0) {
+        fprintf(stderr, "Error: %s contains no edges\n", text_path);
+        status = -1;
+    }
+    if (status == 0) {
+        status = graph_file_write(out_path, (int)(max_vertex + 1), edges, (int)num_edges, 1, 1);
+    }
+    free(edges);
+    return status;
+}
+
+// --- Loading ---
+
+/**
+ * @brief Checks that a section of 'size' bytes at 'offset' lies inside the file and is aligned.
+ */
+static int section_ok(uint64_t offset, uint64_t size, uint64_t file_size) {
+    return offset % GRAPH_FILE_ALIGN == 0 && offset >= sizeof(GraphFileHeader) &&
+           offset <= file_size && size <= file_size - offset;
+}
+
+/**
+ * @brief Checks that every edge endpoint is a vertex id in [0, num_vertices).
+ */
+static int edges_ok(const Edge *edges, uint64_t num_edges, uint64_t num_vertices) {
+    for (uint64_t i = 0; i < num_edges; i++) {
+        if (edges[i].u < 0 || (uint64_t)edges[i].u >= num_vertices ||
+            edges[i].v < 0 || (uint64_t)edges[i].v >= num_vertices) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Checks that the CSR offsets never decrease and every target is a vertex id.
+ * * offsets[0] == 0 and offsets[num_vertices] == num_arcs are checked by the caller.
+ */
+static int csr_ok(const uint64_t *offsets, const int *targets, uint64_t num_arcs, uint64_t num_vertices) {
+    for (uint64_t v = 0; v < num_vertices; v++) {
+        if (offsets[v] > offsets[v + 1]) {
+            return 0;
+        }
+    }
+    for (uint64_t a = 0; a < num_arcs; a++) {
+        if (targets[a] < 0 || (uint64_t)targets[a] >= num_vertices) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+GraphFile *graph_file_open(const char *path, bool verify) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: cannot open %s\n", path);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(GraphFileHeader)) {
+        fprintf(stderr, "Error: %s is not a graph file\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    size_t length = (size_t)st.st_size;
+    void *base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps the file referenced
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "Error: cannot map %s\n", path);
+        return NULL;
+    }
+
+    const GraphFileHeader *header = base;
+    uint64_t file_size = length;
+    int valid = memcmp(header->magic, GRAPH_FILE_MAGIC, sizeof(header->magic)) == 0 &&
+                header->version == GRAPH_FILE_VERSION &&
+                header->num_vertices > 0 && header->num_vertices <= INT_MAX &&
+                header->num_edges <= INT_MAX;
+    if (valid && header->edges_offset) {
+        valid = section_ok(header->edges_offset, sizeof(Edge) * header->num_edges, file_size);
+    }
+    if (valid && header->offsets_offset) {
+        valid = header->num_arcs <= 2 * header->num_edges &&
+                section_ok(header->offsets_offset, sizeof(uint64_t) * (header->num_vertices + 1), file_size) &&
+                section_ok(header->targets_offset, sizeof(int) * header->num_arcs, file_size) &&
+                section_ok(header->weights_offset, sizeof(int) * header->num_arcs, file_size);
+    }
+    if (valid && header->offsets_offset) {
+        const uint64_t *offsets = (const uint64_t *)((const char *)base + header->offsets_offset);
+        valid = offsets[0] == 0 && offsets[header->num_vertices] == header->num_arcs;
+    }
+    if (valid && verify && header->edges_offset) {
+        valid = edges_ok((const Edge *)((const char *)base + header->edges_offset), header->num_edges,
+                         header->num_vertices);
+    }
+    if (valid && verify && header->offsets_offset) {
+        valid = csr_ok((const uint64_t *)((const char *)base + header->offsets_offset),
+                       (const int *)((const char *)base + header->targets_offset), header->num_arcs,
+                       header->num_vertices);
+    }
+
+    GraphFile *file = valid ? malloc(sizeof(GraphFile)) : NULL;
+    if (!file) {
+        fprintf(stderr, "Error: %s is not a valid graph file\n", path);
+        munmap(base, length);
+        return NULL;
+    }
+
+    file->base = base;
+    file->length = length;
+    file->num_vertices = (int)header->num_vertices;
+    file->num_edges = (int)header->num_edges;
+    file->edges = header->edges_offset ? (Edge *)((char *)base + header->edges_offset) : NULL;
+    file->has_csr = header->offsets_offset != 0;
+    file->csr.num_vertices = file->num_vertices;
+    file->csr.num_arcs = header->num_arcs;
+    file->csr.offsets = file->has_csr ? (const uint64_t *)((char *)base + header->offsets_offset) : NULL;
+    file->csr.targets = file->has_csr ? (const int *)((char *)base + header->targets_offset) : NULL;
+    file->csr.weights = file->has_csr ? (const int *)((char *)base + header->weights_offset) : NULL;
+    return file;
+}
+
+void graph_file_close(GraphFile *file) {
+    if (file) {
+        munmap(file->base, file->length);
+        free(file);
+    }
+}
+
+int graph_file_num_vertices(const GraphFile *file) {
+    return file->num_vertices;
+}
+
+Edge *graph_file_edges(GraphFile *file, int *num_edges) {
+    *num_edges = file->edges ? file->num_edges : 0;
+    return file->edges;
+}
+
+const CSRGraph *graph_file_csr(const GraphFile *file) {
+    return file->has_csr ? &file->csr : NULL;
+}
@@ -0,0 +1,85 @@
+/*
+ *  Compact binary graph file format, loaded with mmap.
+ *
+ *  Layout (all integers little-endian, every section 64-byte aligned):
+ *
+ *    GraphFileHeader                            72 bytes
+ *    edges    Edge[num_edges]      {u, v, weight} as int32 triples    (optional)
+ *    offsets  uint64_t[num_vertices + 1]                              (optional, CSR)
+ *    targets  int32_t[num_arcs]                                       (optional, CSR)
+ *    weights  int32_t[num_arcs]                                       (optional, CSR)
+ *
+ *  A section whose offset is 0 is absent.
+ */
+
+#ifndef TEMPLATE_GRAPH_FILE_H
+#define TEMPLATE_GRAPH_FILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "MinCostSpanninTree.h"
+
+#define GRAPH_FILE_MAGIC "MCSTGRPH"
+#define GRAPH_FILE_VERSION 1
+
+typedef struct {
+    char magic[8];            ///< GRAPH_FILE_MAGIC, not NUL-terminated.
+    uint32_t version;         ///< GRAPH_FILE_VERSION.
+    uint32_t reserved;
+    uint64_t num_vertices;
+    uint64_t num_edges;
+    uint64_t num_arcs;        ///< 2 * num_edges if the CSR sections are present, else 0.
+    uint64_t edges_offset;    ///< Byte offsets of the sections from the start of the file.
+    uint64_t offsets_offset;
+    uint64_t targets_offset;
+    uint64_t weights_offset;
+} GraphFileHeader;
+
+typedef struct GraphFile GraphFile;
+
+/**
+ * @brief Maps a graph file into memory. Nothing is copied or parsed: the
+ * edge list and CSR views point straight into the mapping.
+ * * The mapping is private and copy-on-write, so kruskal_mcst may reorder the
+ * edge view in place without changing the file.
+ * @param path The file to open.
+ * @param verify Whether to check, in one O(V + E) pass, that every vertex id is in range and the
+ * CSR offsets never decrease. Skip it only for trusted files: the MCST algorithms index with these values.
+ * @return GraphFile* The mapped file, or NULL if it cannot be opened or is malformed.
+ */
+GraphFile *graph_file_open(const char *path, bool verify);
+/**
+ * @brief Unmaps the file. Views obtained from it become invalid.
+ */
+void graph_file_close(GraphFile *file);
+/**
+ * @brief Returns the number of vertices of the graph.
+ */
+int graph_file_num_vertices(const GraphFile *file);
+/**
+ * @brief Returns the edge list view, or NULL if the file has no edge section.
+ * @param num_edges Receives the number of edges.
+ */
+Edge *graph_file_edges(GraphFile *file, int *num_edges);
+/**
+ * @brief Returns the CSR view, or NULL if the file has no CSR sections.
+ */
+const CSRGraph *graph_file_csr(const GraphFile *file);
+/**
+ * @brief Writes a graph file.
+ * @param with_edges Non-zero to store the edge list section.
+ * @param with_csr Non-zero to build and store the CSR sections.
+ * @return int 0 on success, -1 on failure.
+ */
+int graph_file_write(const char *path, int num_vertices, const Edge edges[], int num_edges,
+                     int with_edges, int with_csr);
+/**
+ * @brief Converts a text edge list into a graph file with both edge list and CSR sections.
+ * * Each non-empty line holds "u v weight"; lines starting with '#' or '%' are comments.
+ * The vertex count is one more than the largest vertex id.
+ * @return int 0 on success, -1 on failure.
+ */
+int graph_file_convert_text(const char *text_path, const char *out_path);
+
+#endif //TEMPLATE_GRAPH_FILE_H
@@ -0,0 +1,111 @@
+/*
+ *  Benchmark: parallel Boruvka and CSR Prim against Kruskal on a random connected graph.
+ *  Also measures bottleneck-path queries on the resulting tree.
+ *  Usage: mcst-bench [num_vertices] [num_edges] [threads ...]
+ *         (default: 1M vertices, 20M edges, 1 8 16 32 threads)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "MinCostSpanninTree.h"
+#include "bottleneck_index.h"
+#include "../bench_util.h"
+
+#define NUM_QUERIES 10000000
+
+int main(int argc, char *argv[]) {
+    int num_vertices = argc > 1 ? atoi(argv[1]) : 1000000;
+    int num_edges = argc > 2 ? atoi(argv[2]) : 20000000;
+    int default_threads[] = {1, 8, 16, 32};
+    int *thread_counts = default_threads;
+    int num_runs = 4;
+    if (argc > 3) {
+        thread_counts = malloc(sizeof(int) * (argc - 3));
+        num_runs = argc - 3;
+        for (int i = 0; i < num_runs; i++) thread_counts[i] = atoi(argv[3 + i]);
+    }
+    if (num_edges < num_vertices - 1) num_edges = num_vertices - 1;
+
+    // A random path keeps the graph connected; the rest are uniform random edges.
+    Edge *edges = malloc(sizeof(Edge) * num_edges);
+    Edge *work = malloc(sizeof(Edge) * num_edges);
+    if (!edges || !work) {
+        fprintf(stderr, "Edge allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 99;
+    for (int i = 0; i < num_edges; i++) {
+        if (i < num_vertices - 1) {
+            edges[i].u = i;
+            edges[i].v = i + 1;
+        } else {
+            edges[i].u = (int)(next_rand(&state) % num_vertices);
+            edges[i].v = (int)(next_rand(&state) % num_vertices);
+        }
+        edges[i].weight = (int)(next_rand(&state) % 1000000000);
+    }
+
+    memcpy(work, edges, sizeof(Edge) * num_edges);
+    double start = now_sec();
+    long long kruskal_cost = kruskal_mcst(num_vertices, work, num_edges);
+    double kruskal_time = now_sec() - start;
+    printf("V=%d E=%d  Kruskal: %.3f s  cost=%lld\n", num_vertices, num_edges, kruskal_time, kruskal_cost);
+
+    CSRGraph *csr = csr_from_edges(num_vertices, edges, num_edges);
+    if (csr) {
+        start = now_sec();
+        long long prim_cost = prim_csr_mcst(csr);
+        double prim_time = now_sec() - start;
+        printf("Prim (CSR, 4-ary heap): %.3f s%s\n", prim_time, prim_cost == kruskal_cost ? "" : "  COST MISMATCH");
+        csr_free(csr);
+    }
+
+    for (int r = 0; r < num_runs; r++) {
+        int forest_size = 0;
+        start = now_sec();
+        long long cost = boruvka_mcst(num_vertices, edges, num_edges, thread_counts[r], NULL, &forest_size);
+        double time = now_sec() - start;
+        printf("threads=%3d  Boruvka: %.3f s  (%.2fx vs Kruskal)%s\n", thread_counts[r], time,
+               kruskal_time / time, cost == kruskal_cost ? "" : "  COST MISMATCH");
+    }
+
+    // Bottleneck-path queries over the spanning tree.
+    Edge *forest = malloc(sizeof(Edge) * num_vertices);
+    int *query_u = malloc(sizeof(int) * NUM_QUERIES);
+    int *query_v = malloc(sizeof(int) * NUM_QUERIES);
+    int *weights = malloc(sizeof(int) * NUM_QUERIES);
+    if (forest && query_u && query_v && weights) {
+        int num_forest_edges = 0;
+        memcpy(work, edges, sizeof(Edge) * num_edges);
+        kruskal_mcst_forest(num_vertices, work, num_edges, forest, &num_forest_edges);
+        start = now_sec();
+        BottleneckIndex *index = bottleneck_index_new(num_vertices, forest, num_forest_edges);
+        double build_time = now_sec() - start;
+        if (index) {
+            for (int i = 0; i < NUM_QUERIES; i++) {
+                query_u[i] = (int)(next_rand(&state) % num_vertices);
+                query_v[i] = (int)(next_rand(&state) % num_vertices);
+            }
+            start = now_sec();
+            bottleneck_query_batch(index, query_u, query_v, NUM_QUERIES, weights, NULL);
+            double query_time = now_sec() - start;
+            printf("Bottleneck index: build %.3f s, %.1f M queries/s\n", build_time,
+                   NUM_QUERIES / query_time / 1e6);
+            bottleneck_index_free(index);
+        }
+    }
+    free(forest);
+    free(query_u);
+    free(query_v);
+    free(weights);
+
+    free(edges);
+    free(work);
+    if (thread_counts != default_threads) free(thread_counts);
+    return 0;
+}
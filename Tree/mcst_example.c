@@ -0,0 +1,98 @@
+/*
+ *  Examples for the MCST algorithms in MinCostSpanninTree.c.
+ */
+
+#include <stdio.h>
+#include <limits.h>
+
+#include "MinCostSpanninTree.h"
+#include "bottleneck_index.h"
+
+#define NUM_VERTICES_EX 5
+#define NUM_EDGES_EX 7
+#define INF INT_MAX
+
+int main() {
+    // --- Kruskal Example ---
+    printf("--- Kruskal's Algorithm Example ---\n");
+    Edge kruskal_edges[NUM_EDGES_EX] = {
+        {0, 1, 10},
+        {0, 2, 6},
+        {0, 3, 5},
+        {1, 3, 15},
+        {2, 3, 4},
+        {3, 4, 16},
+        {2, 4, 7}
+    };
+
+    long long kruskal_cost = kruskal_mcst(NUM_VERTICES_EX, kruskal_edges, NUM_EDGES_EX);
+    if (kruskal_cost != -1) {
+        printf("Kruskal MCST Cost: %lld\n", kruskal_cost);
+    } else {
+        printf("Kruskal: Graph is disconnected.\n");
+    }
+
+    long long filter_cost = filter_kruskal_mcst(NUM_VERTICES_EX, kruskal_edges, NUM_EDGES_EX);
+    if (filter_cost != -1) {
+        printf("Filter-Kruskal MCST Cost: %lld\n", filter_cost);
+    } else {
+        printf("Filter-Kruskal: Graph is disconnected.\n");
+    }
+
+    // --- Bottleneck Query Example ---
+    Edge forest[NUM_VERTICES_EX - 1];
+    int num_forest_edges = 0;
+    kruskal_mcst_forest(NUM_VERTICES_EX, kruskal_edges, NUM_EDGES_EX, forest, &num_forest_edges);
+    BottleneckIndex *bottleneck = bottleneck_index_new(NUM_VERTICES_EX, forest, num_forest_edges);
+    if (bottleneck) {
+        int weight;
+        if (bottleneck_query(bottleneck, 1, 4, &weight)) {
+            printf("Heaviest MCST edge between 1 and 4: %d\n", weight);
+        }
+        bottleneck_index_free(bottleneck);
+    }
+
+    // --- Boruvka Example ---
+    printf("\n--- Boruvka's Algorithm Example ---\n");
+    int forest_size = 0;
+    long long boruvka_cost = boruvka_mcst(NUM_VERTICES_EX, kruskal_edges, NUM_EDGES_EX, 2, NULL, &forest_size);
+    if (forest_size == NUM_VERTICES_EX - 1) {
+        printf("Boruvka MCST Cost: %lld\n", boruvka_cost);
+    } else {
+        printf("Boruvka: Graph is disconnected, spanning forest cost %lld.\n", boruvka_cost);
+    }
+
+    // --- Prim (CSR) Example ---
+    printf("\n--- Prim's Algorithm on a CSR Graph Example ---\n");
+    CSRGraph *csr = csr_from_edges(NUM_VERTICES_EX, kruskal_edges, NUM_EDGES_EX);
+    if (csr) {
+        long long csr_cost = prim_csr_mcst(csr);
+        if (csr_cost != -1) {
+            printf("Prim (CSR) MCST Cost: %lld\n", csr_cost);
+        } else {
+            printf("Prim (CSR): Graph is disconnected.\n");
+        }
+        csr_free(csr);
+    }
+
+    // --- Prim Example ---
+    printf("\n--- Prim's Algorithm Example ---\n");
+    // Adjacency Matrix representation
+    int prim_adj_matrix[NUM_VERTICES_EX][NUM_VERTICES_EX] = {
+        //   0   1   2   3   4
+        {INF, 10,  6,  5, INF}, // 0
+        { 10, INF, INF, 15, INF}, // 1
+        {  6, INF, INF,  4,  7}, // 2
+        {  5, 15,  4, INF, 16}, // 3
+        {INF, INF,  7, 16, INF}  // 4
+    };
+
+    long long prim_cost = prim_mcst(NUM_VERTICES_EX, prim_adj_matrix);
+    if (prim_cost != -1) {
+        printf("Prim MCST Cost: %lld\n", prim_cost);
+    } else {
+        printf("Prim: Graph is disconnected.\n");
+    }
+
+    return 0;
+}
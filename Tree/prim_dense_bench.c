@@ -0,0 +1,85 @@
+/*
+ *  Benchmark: vectorized dense prim_mcst against the scalar two-loop Prim
+ *  on a complete graph with random weights.
+ *  Usage: prim-dense-bench [num_vertices]   (default: 20000)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include "MinCostSpanninTree.h"
+#include "../bench_util.h"
+
+/**
+ * @brief The scalar O(V^2) Prim with separate Extract Min and update loops, as the baseline.
+ */
+static long long scalar_prim(int n, int adj_matrix[n][n]) {
+    int *key = malloc(sizeof(int) * n);
+    bool *in_mst = malloc(sizeof(bool) * n);
+    for (int i = 0; i < n; i++) {
+        key[i] = INT_MAX;
+        in_mst[i] = false;
+    }
+    key[0] = 0;
+    long long total_cost = 0;
+    int mst_size = 0;
+    while (mst_size < n) {
+        int min_key = INT_MAX;
+        int u = -1;
+        for (int v = 0; v < n; v++) {
+            if (in_mst[v] == false && key[v] < min_key) {
+                min_key = key[v];
+                u = v;
+            }
+        }
+        if (u == -1) break;
+        in_mst[u] = true;
+        total_cost += min_key;
+        mst_size++;
+        for (int v = 0; v < n; v++) {
+            if (adj_matrix[u][v] != INT_MAX && in_mst[v] == false && adj_matrix[u][v] < key[v]) {
+                key[v] = adj_matrix[u][v];
+            }
+        }
+    }
+    free(key);
+    free(in_mst);
+    return mst_size == n ? total_cost : -1;
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 20000;
+
+    int (*adj_matrix)[n] = malloc(sizeof(int) * (size_t)n * (size_t)n);
+    if (!adj_matrix) {
+        fprintf(stderr, "Matrix allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 5;
+    for (int u = 0; u < n; u++) {
+        adj_matrix[u][u] = INT_MAX;
+        for (int v = u + 1; v < n; v++) {
+            int w = (int)(next_rand(&state) % 1000000);
+            adj_matrix[u][v] = w;
+            adj_matrix[v][u] = w;
+        }
+    }
+
+    double start = now_sec();
+    long long scalar_cost = scalar_prim(n, adj_matrix);
+    double scalar_time = now_sec() - start;
+
+    start = now_sec();
+    long long cost = prim_mcst(n, adj_matrix);
+    double time = now_sec() - start;
+
+    printf("V=%d  scalar Prim: %.3f s  prim_mcst: %.3f s  (%.2fx)%s\n", n, scalar_time, time,
+           scalar_time / time, cost == scalar_cost ? "" : "  COST MISMATCH");
+    free(adj_matrix);
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*
+ *  Timing and key generation shared by the benchmark programs.
+ *
+ *  A benchmark defines _POSIX_C_SOURCE 199309L before its first #include so
+ *  that <time.h> declares clock_gettime.
+ */
+
+#ifndef TEMPLATE_BENCH_UTIL_H
+#define TEMPLATE_BENCH_UTIL_H
+
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief Monotonic wall-clock time in seconds.
+ */
+static inline double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief The SplitMix64 output function: a bijection of its 64-bit input.
+ */
+static inline uint64_t splitmix64_mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief SplitMix64 pseudo-random generator. The state walks through all 2^64
+ * * values before repeating and the output is a bijection of it, so one stream
+ * * never repeats a key.
+ */
+static inline uint64_t next_rand(uint64_t *state) {
+    return splitmix64_mix(*state += 0x9E3779B97F4A7C15ULL);
+}
+
+#endif //TEMPLATE_BENCH_UTIL_H
@@ -0,0 +1,39 @@
+/*
+ *  Cache-line-blocked Bloom filter over 64-bit keys: one 64-byte block per key.
+ */
+
+#ifndef TEMPLATE_BLOCKED_BLOOM_FILTER_H
+#define TEMPLATE_BLOCKED_BLOOM_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct BlockedBloomFilter BlockedBloomFilter;
+
+/**
+ * @brief Creates a blocked filter with the bit budget of a standard filter for ('expected_n', 'target_fpr').
+ * * Blocking makes the bits of one block fill unevenly, so the measured
+ * false-positive rate is somewhat above 'target_fpr' at the same size.
+ * @return BlockedBloomFilter* The new filter, or NULL on failure.
+ */
+BlockedBloomFilter *bbf_create(size_t expected_n, double target_fpr);
+/**
+ * @brief Frees all memory associated with the filter.
+ */
+void bbf_free(BlockedBloomFilter *bf);
+/**
+ * @brief Inserts a 64-bit key: sets 8 bits inside a single 64-byte block.
+ */
+void bbf_insert(BlockedBloomFilter *bf, uint64_t key);
+/**
+ * @brief Checks a 64-bit key with one cache miss.
+ * @return bool true ("Maybe") if all 8 bits of the key's block are set, false ("No") otherwise.
+ */
+bool bbf_member(const BlockedBloomFilter *bf, uint64_t key);
+/**
+ * @brief Returns the size of the bit array (a multiple of 512).
+ */
+uint64_t bbf_num_bits(const BlockedBloomFilter *bf);
+
+#endif //TEMPLATE_BLOCKED_BLOOM_FILTER_H
@@ -0,0 +1,254 @@
+/*
+ *  Benchmark: false-positive rate and throughput of the runtime-sized, blocked and scalable Bloom
+ *  filters, plus merging shard filters with bf_union and reopening a snapshot.
+ *  Usage: bloom-bench [num_keys] [target_fpr] [num_queries] [snapshot_path]
+ *         (default: 100M keys, 1% target, 10M queries, no snapshot)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "bloom_filter.h"
+#include "blocked_bloom_filter.h"
+#include "scalable_bloom_filter.h"
+#include "bench_util.h"
+
+#define BATCH_SIZE 4096
+#define SCALABLE_INITIAL_FRACTION 1024   ///< The scalable filter starts sized for num_keys / 1024.
+
+static void fill_keys(uint64_t keys[], size_t count, uint64_t *state) {
+    for (size_t i = 0; i < count; i++) {
+        keys[i] = next_rand(state);
+    }
+}
+
+static size_t count_bits(const uint64_t bitmap[], size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < (n + 63) / 64; i++) {
+        total += (size_t)__builtin_popcountll(bitmap[i]);
+    }
+    return total;
+}
+
+static size_t count_false_positives(const BloomFilter64 *bf, uint64_t state, size_t num_queries) {
+    size_t false_positives = 0;
+    for (size_t i = 0; i < num_queries; i++) {
+        false_positives += bf_member_u64(bf, next_rand(&state));
+    }
+    return false_positives;
+}
+
+/**
+ * @brief Rebuilds 'full' as two shard filters merged with bf_union, then round-trips it through a snapshot.
+ */
+static void bench_union_and_snapshot(const BloomFilter64 *full, size_t num_keys, double target_fpr,
+                                     uint64_t query_state, size_t num_queries, size_t expected,
+                                     const char *snapshot_path) {
+    BloomFilter64 *shard_a = bf_create(num_keys, target_fpr);
+    BloomFilter64 *shard_b = bf_create(num_keys, target_fpr);
+    if (!shard_a || !shard_b) {
+        bf_free(shard_a);
+        bf_free(shard_b);
+        return;
+    }
+    uint64_t state = 7;
+    for (size_t i = 0; i < num_keys; i++) {
+        bf_insert_u64(i % 2 ? shard_b : shard_a, next_rand(&state));
+    }
+    double start = now_sec();
+    bf_union(shard_a, shard_b);
+    double union_time = now_sec() - start;
+    printf("union     %.1f GB/s%s\n", (double)bf_num_bits(full) / 8 / union_time / 1e9,
+           count_false_positives(shard_a, query_state, num_queries) != expected ? "  MISMATCH" : "");
+    bf_free(shard_a);
+    bf_free(shard_b);
+
+    if (!snapshot_path) {
+        return;
+    }
+    start = now_sec();
+    if (bf_snapshot_save(full, snapshot_path) != 0) {
+        return;
+    }
+    double save_time = now_sec() - start;
+    start = now_sec();
+    BloomFilter64 *loaded = bf_snapshot_open(snapshot_path, false);
+    double open_time = now_sec() - start;
+    start = now_sec();
+    BloomFilter64 *verified = bf_snapshot_open(snapshot_path, true);
+    double verify_time = now_sec() - start;
+    if (loaded && verified) {
+        printf("snapshot  save %.3f s  open %.6f s  open+verify %.3f s%s\n", save_time, open_time, verify_time,
+               count_false_positives(loaded, query_state, num_queries) != expected ? "  MISMATCH" : "");
+    }
+    bf_free(loaded);
+    bf_free(verified);
+    remove(snapshot_path);
+}
+
+int main(int argc, char *argv[]) {
+    size_t num_keys = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000000;
+    double target_fpr = argc > 2 ? atof(argv[2]) : 0.01;
+    size_t num_queries = argc > 3 ? strtoull(argv[3], NULL, 10) : 10000000;
+    const char *snapshot_path = argc > 4 ? argv[4] : NULL;
+
+    BloomFilter64 *bf = bf_create(num_keys, target_fpr);
+    if (!bf) {
+        return 1;
+    }
+    double flat_bits_per_key = (double)bf_num_bits(bf) / (double)num_keys;
+    printf("n=%zu  m=%llu bits (%.2f bits/key)  k=%d\n", num_keys, (unsigned long long)bf_num_bits(bf),
+           flat_bits_per_key, bf_num_hashes(bf));
+
+    // Inserted keys and probe keys come from one stream, so every probe is a true negative.
+    uint64_t state = 7;
+    double start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        bf_insert_u64(bf, next_rand(&state));
+    }
+    double insert_time = now_sec() - start;
+    uint64_t query_state = state;
+
+    size_t false_positives = 0;
+    start = now_sec();
+    for (size_t i = 0; i < num_queries; i++) {
+        false_positives += bf_member_u64(bf, next_rand(&state));
+    }
+    double query_time = now_sec() - start;
+
+    size_t misses = 0;
+    state = 7;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        misses += !bf_member_u64(bf, next_rand(&state));
+    }
+    double positive_time = now_sec() - start;
+
+    double measured = (double)false_positives / (double)num_queries;
+    double theoretical = bf_theoretical_fpr(bf, num_keys);
+    printf("standard  insert: %6.1f M/s  negative query: %6.1f M/s  positive query: %6.1f M/s\n",
+           num_keys / insert_time / 1e6, num_queries / query_time / 1e6, num_keys / positive_time / 1e6);
+    printf("          FPR measured %.5f%%  theoretical %.5f%%  (%+.1f%%)%s\n", measured * 100, theoretical * 100,
+           (measured / theoretical - 1) * 100, misses ? "  FALSE NEGATIVES" : "");
+    bf_free(bf);
+
+    // --- Same filter, batched calls ---
+    bf = bf_create(num_keys, target_fpr);
+    uint64_t *keys = malloc(sizeof(uint64_t) * BATCH_SIZE);
+    uint64_t *bitmap = malloc(sizeof(uint64_t) * (BATCH_SIZE / 64));
+    if (!bf || !keys || !bitmap) {
+        return 1;
+    }
+    state = 7;
+    double batch_insert_time = 0;
+    for (size_t done = 0; done < num_keys; done += BATCH_SIZE) {
+        size_t count = num_keys - done < BATCH_SIZE ? num_keys - done : BATCH_SIZE;
+        fill_keys(keys, count, &state);
+        start = now_sec();
+        bf_insert_batch(bf, keys, count);
+        batch_insert_time += now_sec() - start;
+    }
+    size_t batch_false_positives = 0;
+    double batch_query_time = 0;
+    for (size_t done = 0; done < num_queries; done += BATCH_SIZE) {
+        size_t count = num_queries - done < BATCH_SIZE ? num_queries - done : BATCH_SIZE;
+        fill_keys(keys, count, &state);
+        start = now_sec();
+        bf_member_batch(bf, keys, count, bitmap);
+        batch_query_time += now_sec() - start;
+        batch_false_positives += count_bits(bitmap, count);
+    }
+    misses = 0;
+    state = 7;
+    double batch_positive_time = 0;
+    for (size_t done = 0; done < num_keys; done += BATCH_SIZE) {
+        size_t count = num_keys - done < BATCH_SIZE ? num_keys - done : BATCH_SIZE;
+        fill_keys(keys, count, &state);
+        start = now_sec();
+        bf_member_batch(bf, keys, count, bitmap);
+        batch_positive_time += now_sec() - start;
+        misses += count - count_bits(bitmap, count);
+    }
+    printf("batched   insert: %6.1f M/s  negative query: %6.1f M/s  positive query: %6.1f M/s%s\n",
+           num_keys / batch_insert_time / 1e6, num_queries / batch_query_time / 1e6,
+           num_keys / batch_positive_time / 1e6,
+           misses || batch_false_positives != false_positives ? "  MISMATCH" : "");
+    bench_union_and_snapshot(bf, num_keys, target_fpr, query_state, num_queries, false_positives, snapshot_path);
+    bf_free(bf);
+    free(keys);
+    free(bitmap);
+
+    // --- Blocked filter, same bit budget ---
+    BlockedBloomFilter *bbf = bbf_create(num_keys, target_fpr);
+    if (!bbf) {
+        return 1;
+    }
+    state = 7;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        bbf_insert(bbf, next_rand(&state));
+    }
+    double blocked_insert_time = now_sec() - start;
+
+    false_positives = 0;
+    start = now_sec();
+    for (size_t i = 0; i < num_queries; i++) {
+        false_positives += bbf_member(bbf, next_rand(&state));
+    }
+    double blocked_query_time = now_sec() - start;
+
+    misses = 0;
+    state = 7;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        misses += !bbf_member(bbf, next_rand(&state));
+    }
+    double blocked_positive_time = now_sec() - start;
+
+    printf("blocked   insert: %6.1f M/s  negative query: %6.1f M/s  positive query: %6.1f M/s\n",
+           num_keys / blocked_insert_time / 1e6, num_queries / blocked_query_time / 1e6,
+           num_keys / blocked_positive_time / 1e6);
+    printf("          FPR measured %.5f%%  (m=%llu bits)  query speedup %.2fx / %.2fx%s\n",
+           (double)false_positives / (double)num_queries * 100, (unsigned long long)bbf_num_bits(bbf),
+           query_time / blocked_query_time, positive_time / blocked_positive_time,
+           misses ? "  FALSE NEGATIVES" : "");
+    bbf_free(bbf);
+
+    // --- Scalable filter, started far too small ---
+    size_t initial = num_keys / SCALABLE_INITIAL_FRACTION > 0 ? num_keys / SCALABLE_INITIAL_FRACTION : 1;
+    ScalableBloomFilter *sbf = sbf_create(initial, target_fpr);
+    if (!sbf) {
+        return 1;
+    }
+    state = 7;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        sbf_insert(sbf, next_rand(&state));
+    }
+    double scalable_insert_time = now_sec() - start;
+    false_positives = 0;
+    start = now_sec();
+    for (size_t i = 0; i < num_queries; i++) {
+        false_positives += sbf_member(sbf, next_rand(&state));
+    }
+    double scalable_query_time = now_sec() - start;
+    misses = 0;
+    state = 7;
+    for (size_t i = 0; i < num_keys; i++) {
+        misses += !sbf_member(sbf, next_rand(&state));
+    }
+    printf("scalable  insert: %6.1f M/s  negative query: %6.1f M/s  (%d stages from %zu keys)\n",
+           num_keys / scalable_insert_time / 1e6, num_queries / scalable_query_time / 1e6,
+           sbf_num_stages(sbf), initial);
+    double scalable_bits_per_key = (double)sbf_num_bits(sbf) / (double)num_keys;
+    double bits_bound = sbf_bits_per_key_bound(sbf);
+    printf("          FPR measured %.5f%%  bound %.5f%%%s\n", (double)false_positives / (double)num_queries * 100,
+           target_fpr * 100, misses ? "  FALSE NEGATIVES" : "");
+    printf("          %.2f bits/key  bound %.2f  (flat filter %.2f)%s\n", scalable_bits_per_key, bits_bound,
+           flat_bits_per_key, scalable_bits_per_key > bits_bound ? "  ABOVE BOUND" : "");
+    sbf_free(sbf);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ *  Benchmark: hashing and Bloom filter throughput for byte-string keys (GB/s of key bytes).
+ *  Usage: bloom-bytes-bench [num_keys] [min_len] [max_len]
+ *         (default: 10M keys of 16 to 64 bytes)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "bloom_filter.h"
+#include "bench_util.h"
+
+#define TARGET_FPR 0.01
+
+int main(int argc, char *argv[]) {
+    size_t num_keys = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    size_t min_len = argc > 2 ? strtoull(argv[2], NULL, 10) : 16;
+    size_t max_len = argc > 3 ? strtoull(argv[3], NULL, 10) : 64;
+    if (max_len < min_len) max_len = min_len;
+
+    // Keys are packed back to back like strings read from a file; the first 8 bytes
+    // are a unique counter so that all keys are distinct.
+    size_t *lens = malloc(sizeof(size_t) * num_keys);
+    const void **keys = malloc(sizeof(void *) * num_keys);
+    uint64_t *hashes = malloc(sizeof(uint64_t) * num_keys);
+    uint64_t *bitmap = malloc(sizeof(uint64_t) * ((num_keys + 63) / 64));
+    if (!lens || !keys || !hashes || !bitmap) {
+        fprintf(stderr, "Key allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 5;
+    size_t total_bytes = 0;
+    for (size_t i = 0; i < num_keys; i++) {
+        lens[i] = min_len + next_rand(&state) % (max_len - min_len + 1);
+        if (lens[i] < 8) lens[i] = 8;
+        total_bytes += lens[i];
+    }
+    unsigned char *buffer = malloc(total_bytes);
+    if (!buffer) {
+        fprintf(stderr, "Key allocation failed!\n");
+        return 1;
+    }
+    unsigned char *p = buffer;
+    for (size_t i = 0; i < num_keys; i++) {
+        keys[i] = p;
+        uint64_t id = i;
+        for (int b = 0; b < 8; b++) p[b] = (unsigned char)(id >> (8 * b));
+        for (size_t b = 8; b < lens[i]; b++) p[b] = (unsigned char)('a' + next_rand(&state) % 26);
+        p += lens[i];
+    }
+    double gigabytes = (double)total_bytes / 1e9;
+    printf("%zu keys, %zu to %zu bytes, %.2f GB total\n", num_keys, min_len, max_len, gigabytes);
+
+    double start = now_sec();
+    uint64_t check = 0;
+    for (size_t i = 0; i < num_keys; i++) {
+        check ^= bf_hash_bytes(keys[i], lens[i], BF_DEFAULT_SEED);
+    }
+    double scalar_time = now_sec() - start;
+    start = now_sec();
+    bf_hash_bytes_batch(keys, lens, num_keys, BF_DEFAULT_SEED, hashes);
+    double batch_time = now_sec() - start;
+    for (size_t i = 0; i < num_keys; i++) {
+        check ^= hashes[i];
+    }
+    printf("hash    scalar: %6.2f GB/s (%6.1f M keys/s)  batch: %6.2f GB/s (%6.1f M keys/s)%s\n",
+           gigabytes / scalar_time, num_keys / scalar_time / 1e6, gigabytes / batch_time,
+           num_keys / batch_time / 1e6, check ? "  MISMATCH" : "");
+
+    BloomFilter64 *bf = bf_create(num_keys, TARGET_FPR);
+    BloomFilter64 *batch_bf = bf_create(num_keys, TARGET_FPR);
+    if (!bf || !batch_bf) return 1;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        bf_insert_bytes(bf, keys[i], lens[i]);
+    }
+    double insert_time = now_sec() - start;
+    start = now_sec();
+    bf_insert_bytes_batch(batch_bf, keys, lens, num_keys);
+    double batch_insert_time = now_sec() - start;
+
+    size_t found = 0;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        found += bf_member_bytes(bf, keys[i], lens[i]);
+    }
+    double member_time = now_sec() - start;
+    start = now_sec();
+    bf_member_bytes_batch(batch_bf, keys, lens, num_keys, bitmap);
+    double batch_member_time = now_sec() - start;
+    size_t batch_found = 0;
+    for (size_t w = 0; w < (num_keys + 63) / 64; w++) {
+        batch_found += (size_t)__builtin_popcountll(bitmap[w]);
+    }
+
+    printf("insert  single: %6.2f GB/s (%6.1f M keys/s)  batch: %6.2f GB/s (%6.1f M keys/s)\n",
+           gigabytes / insert_time, num_keys / insert_time / 1e6, gigabytes / batch_insert_time,
+           num_keys / batch_insert_time / 1e6);
+    printf("member  single: %6.2f GB/s (%6.1f M keys/s)  batch: %6.2f GB/s (%6.1f M keys/s)%s\n",
+           gigabytes / member_time, num_keys / member_time / 1e6, gigabytes / batch_member_time,
+           num_keys / batch_member_time / 1e6,
+           found != num_keys || batch_found != num_keys ? "  FALSE NEGATIVES" : "");
+
+    bf_free(bf);
+    bf_free(batch_bf);
+    free(buffer);
+    free(lens);
+    free(keys);
+    free(hashes);
+    free(bitmap);
+    return 0;
+}
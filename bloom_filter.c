@@ -1,11 +1,24 @@
 //
 // Created by 林勁博 on 2025/12/4.
 //
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
-#include <math.h> // Included for potential advanced use, though not strictly needed for basic operations
+#include <stdint.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "bloom_filter.h"
 
 // --- 1. Define Bloom Filter Constants and Structure ---
 #define M 11        // Size of the bit array (m) in bits (from slide example)
@@ -148,4 +161,502 @@ void print_bf(BloomFilter *bf) {
         printf("%d", check_bit(bf, i));
     }
     printf("\n");
-}
\ No newline at end of file
+}
+
+// --- 5. Runtime-sized Bloom Filter (64-bit keys) ---
+//
+// The template above fixes m at compile time and derives its probes from
+// (i + 1) * key mod m, so the probes of two keys collide together and the
+// false-positive rate is far above (1 - e^(-kn/m))^k. BloomFilter64 sizes m
+// and k at runtime, hashes the key once with a strong mixer and derives the
+// k probes by Kirsch-Mitzenmacher double hashing: g_i = h1 + i * h2.
+
+struct BloomFilter64 {
+    uint64_t *words;    ///< The bit array, 64 bits per word.
+    uint64_t num_bits;  ///< m, a multiple of 64.
+    uint64_t num_words;
+    int num_hashes;     ///< k
+    uint64_t seed;
+    void *mapping;      ///< Snapshot mapping the words point into, or NULL if heap-allocated.
+    size_t mapping_length;
+};
+
+int bf_optimal_params(size_t expected_n, double target_fpr, uint64_t *num_words, int *num_hashes) {
+    if (expected_n == 0 || !(target_fpr > 0.0 && target_fpr < 1.0)) {
+        fprintf(stderr, "Bloom filter needs expected_n > 0 and 0 < target_fpr < 1!\n");
+        return -1;
+    }
+
+    double ln2 = log(2.0);
+    double bits = ceil(-(double)expected_n * log(target_fpr) / (ln2 * ln2));
+    if (bits > (double)(UINT64_MAX >> 8)) {
+        fprintf(stderr, "Bloom filter is too large!\n");
+        return -1;
+    }
+    *num_words = ((uint64_t)bits + 63) / 64;
+    int k = (int)lround((double)(*num_words * 64) / (double)expected_n * ln2);
+    *num_hashes = k < 1 ? 1 : k > BF_MAX_HASHES ? BF_MAX_HASHES : k;
+    return 0;
+}
+
+BloomFilter64 *bf_create(size_t expected_n, double target_fpr) {
+    uint64_t num_words;
+    int num_hashes;
+    if (bf_optimal_params(expected_n, target_fpr, &num_words, &num_hashes) != 0) {
+        return NULL;
+    }
+
+    BloomFilter64 *bf = malloc(sizeof(BloomFilter64));
+    if (!bf) {
+        fprintf(stderr, "Bloom filter allocation failed!\n");
+        return NULL;
+    }
+    bf->words = calloc(num_words, sizeof(uint64_t));
+    if (!bf->words) {
+        fprintf(stderr, "Bloom filter bit array allocation failed!\n");
+        free(bf);
+        return NULL;
+    }
+    bf->num_words = num_words;
+    bf->num_bits = num_words * 64;
+    bf->num_hashes = num_hashes;
+    bf->seed = BF_DEFAULT_SEED;
+    bf->mapping = NULL;
+    bf->mapping_length = 0;
+    return bf;
+}
+
+void bf_free(BloomFilter64 *bf) {
+    if (bf) {
+        if (bf->mapping) {
+            munmap(bf->mapping, bf->mapping_length);
+        } else {
+            free(bf->words);
+        }
+        free(bf);
+    }
+}
+
+static inline void bf_set_probes(BloomFilter64 *bf, uint64_t h1, uint64_t h2) {
+    for (int i = 0; i < bf->num_hashes; i++) {
+        uint64_t index = bf_reduce(h1, bf->num_bits);
+        bf->words[index / 64] |= 1ULL << (index % 64);
+        h1 += h2;
+    }
+}
+
+static inline bool bf_test_probes(const BloomFilter64 *bf, uint64_t h1, uint64_t h2) {
+    for (int i = 0; i < bf->num_hashes; i++) {
+        uint64_t index = bf_reduce(h1, bf->num_bits);
+        if (!(bf->words[index / 64] & (1ULL << (index % 64)))) {
+            return false;
+        }
+        h1 += h2;
+    }
+    return true;
+}
+
+void bf_insert_u64(BloomFilter64 *bf, uint64_t key) {
+    uint64_t h1, h2;
+    bf_hash_pair(key, bf->seed, &h1, &h2);
+    bf_set_probes(bf, h1, h2);
+}
+
+bool bf_member_u64(const BloomFilter64 *bf, uint64_t key) {
+    uint64_t h1, h2;
+    bf_hash_pair(key, bf->seed, &h1, &h2);
+    return bf_test_probes(bf, h1, h2);
+}
+
+uint64_t bf_num_bits(const BloomFilter64 *bf) {
+    return bf->num_bits;
+}
+
+int bf_num_hashes(const BloomFilter64 *bf) {
+    return bf->num_hashes;
+}
+
+double bf_theoretical_fpr(const BloomFilter64 *bf, size_t n) {
+    double k = bf->num_hashes;
+    return pow(1.0 - exp(-k * (double)n / (double)bf->num_bits), k);
+}
+
+// --- 6. Batched Operations with Software Prefetch ---
+//
+// One key at a time, every probe is a cache miss that the CPU waits for.
+// The batch calls hash a window of keys first and prefetch every word they
+// will touch, then resolve the probes of the window, so the misses of all
+// keys in the window are in flight at the same time.
+
+#define BF_BATCH_WINDOW 16
+
+/**
+ * @brief Hashes keys[0..count) and prefetches all of their probe words.
+ */
+static inline void bf_hash_window(const BloomFilter64 *bf, const uint64_t keys[], size_t count,
+                                  uint64_t h1[], uint64_t h2[], int for_write) {
+    for (size_t j = 0; j < count; j++) {
+        bf_hash_pair(keys[j], bf->seed, &h1[j], &h2[j]);
+        uint64_t probe = h1[j];
+        for (int i = 0; i < bf->num_hashes; i++) {
+            const uint64_t *word = &bf->words[bf_reduce(probe, bf->num_bits) / 64];
+            if (for_write) {
+                __builtin_prefetch(word, 1);
+            } else {
+                __builtin_prefetch(word, 0);
+            }
+            probe += h2[j];
+        }
+    }
+}
+
+void bf_insert_batch(BloomFilter64 *bf, const uint64_t keys[], size_t n) {
+    uint64_t h1[BF_BATCH_WINDOW], h2[BF_BATCH_WINDOW];
+    for (size_t base = 0; base < n; base += BF_BATCH_WINDOW) {
+        size_t count = n - base < BF_BATCH_WINDOW ? n - base : BF_BATCH_WINDOW;
+        bf_hash_window(bf, keys + base, count, h1, h2, 1);
+        for (size_t j = 0; j < count; j++) {
+            bf_set_probes(bf, h1[j], h2[j]);
+        }
+    }
+}
+
+void bf_member_batch(const BloomFilter64 *bf, const uint64_t keys[], size_t n, uint64_t out_bitmap[]) {
+    uint64_t h1[BF_BATCH_WINDOW], h2[BF_BATCH_WINDOW];
+    memset(out_bitmap, 0, (n + 63) / 64 * sizeof(uint64_t));
+    for (size_t base = 0; base < n; base += BF_BATCH_WINDOW) {
+        size_t count = n - base < BF_BATCH_WINDOW ? n - base : BF_BATCH_WINDOW;
+        bf_hash_window(bf, keys + base, count, h1, h2, 0);
+        for (size_t j = 0; j < count; j++) {
+            size_t i = base + j;
+            out_bitmap[i / 64] |= (uint64_t)bf_test_probes(bf, h1[j], h2[j]) << (i % 64);
+        }
+    }
+}
+
+// --- 7. Snapshots and Set Algebra ---
+//
+// A snapshot is a BloomFileHeader followed by the bit array at offset 64.
+// bf_snapshot_open maps it instead of reading it, so a service can answer
+// queries as soon as the header is checked; pages are faulted in on demand.
+
+_Static_assert(sizeof(BloomFileHeader) == 48, "unexpected BloomFileHeader padding");
+
+#define BLOOM_FILE_BITS_OFFSET 64
+
+/**
+ * @brief Checksum of the bit array: four independent xxHash64-style lanes, folded at the end.
+ */
+static uint64_t bf_checksum(const uint64_t *words, uint64_t num_words) {
+    const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    uint64_t lane[4] = {prime1, prime2, 0, num_words};
+    uint64_t i = 0;
+    for (; i + 4 <= num_words; i += 4) {
+        for (int j = 0; j < 4; j++) {
+            uint64_t x = lane[j] + words[i + j] * prime2;
+            lane[j] = ((x << 31) | (x >> 33)) * prime1;
+        }
+    }
+    uint64_t h = lane[0] ^ (lane[1] << 1) ^ (lane[2] << 2) ^ (lane[3] << 3);
+    for (; i < num_words; i++) {
+        h = (h ^ words[i]) * prime1;
+    }
+    return bf_mix64(h);
+}
+
+int bf_snapshot_save(const BloomFilter64 *bf, const char *path) {
+    BloomFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BLOOM_FILE_MAGIC, sizeof(header.magic));
+    header.version = BLOOM_FILE_VERSION;
+    header.num_hashes = (uint32_t)bf->num_hashes;
+    header.num_bits = bf->num_bits;
+    header.seed = bf->seed;
+    header.checksum = bf_checksum(bf->words, bf->num_words);
+
+    FILE *out = fopen(path, "wb");
+    if (!out) {
+        fprintf(stderr, "Error: cannot create %s\n", path);
+        return -1;
+    }
+    static const char zeros[BLOOM_FILE_BITS_OFFSET - sizeof(BloomFileHeader)] = {0};
+    int ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+             fwrite(zeros, sizeof(zeros), 1, out) == 1 &&
+             fwrite(bf->words, sizeof(uint64_t), bf->num_words, out) == bf->num_words;
+    if (fclose(out) != 0 || !ok) {
+        fprintf(stderr, "Error: cannot write %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+BloomFilter64 *bf_snapshot_open(const char *path, bool verify) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: cannot open %s\n", path);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < BLOOM_FILE_BITS_OFFSET) {
+        fprintf(stderr, "Error: %s is not a Bloom filter snapshot\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    size_t length = (size_t)st.st_size;
+    void *base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps the file referenced
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "Error: cannot map %s\n", path);
+        return NULL;
+    }
+
+    const BloomFileHeader *header = base;
+    uint64_t *words = (uint64_t *)((char *)base + BLOOM_FILE_BITS_OFFSET);
+    int valid = memcmp(header->magic, BLOOM_FILE_MAGIC, sizeof(header->magic)) == 0 &&
+                header->version == BLOOM_FILE_VERSION &&
+                header->num_hashes > 0 && header->num_hashes <= BF_MAX_HASHES &&
+                header->num_bits > 0 && header->num_bits % 64 == 0 &&
+                header->num_bits / 8 == length - BLOOM_FILE_BITS_OFFSET;
+    if (valid && verify) {
+        valid = bf_checksum(words, header->num_bits / 64) == header->checksum;
+    }
+
+    BloomFilter64 *bf = valid ? malloc(sizeof(BloomFilter64)) : NULL;
+    if (!bf) {
+        fprintf(stderr, "Error: %s is not a valid Bloom filter snapshot\n", path);
+        munmap(base, length);
+        return NULL;
+    }
+    bf->words = words;
+    bf->num_bits = header->num_bits;
+    bf->num_words = header->num_bits / 64;
+    bf->num_hashes = (int)header->num_hashes;
+    bf->seed = header->seed;
+    bf->mapping = base;
+    bf->mapping_length = length;
+    return bf;
+}
+
+bool bf_compatible(const BloomFilter64 *a, const BloomFilter64 *b) {
+    return a->num_bits == b->num_bits && a->num_hashes == b->num_hashes && a->seed == b->seed;
+}
+
+int bf_union(BloomFilter64 *dst, const BloomFilter64 *src) {
+    if (!bf_compatible(dst, src)) {
+        fprintf(stderr, "Bloom filters differ in size, probes or seed!\n");
+        return -1;
+    }
+    uint64_t *d = dst->words;
+    const uint64_t *s = src->words;
+    uint64_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= dst->num_words; i += 4) {
+        __m256i x = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(d + i)),
+                                    _mm256_loadu_si256((const __m256i *)(s + i)));
+        _mm256_storeu_si256((__m256i *)(d + i), x);
+    }
+#endif
+    for (; i < dst->num_words; i++) {
+        d[i] |= s[i];
+    }
+    return 0;
+}
+
+int bf_intersect(BloomFilter64 *dst, const BloomFilter64 *src) {
+    if (!bf_compatible(dst, src)) {
+        fprintf(stderr, "Bloom filters differ in size, probes or seed!\n");
+        return -1;
+    }
+    uint64_t *d = dst->words;
+    const uint64_t *s = src->words;
+    uint64_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= dst->num_words; i += 4) {
+        __m256i x = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(d + i)),
+                                     _mm256_loadu_si256((const __m256i *)(s + i)));
+        _mm256_storeu_si256((__m256i *)(d + i), x);
+    }
+#endif
+    for (; i < dst->num_words; i++) {
+        d[i] &= s[i];
+    }
+    return 0;
+}
+
+// --- 8. Byte-String Keys ---
+//
+// bf_hash_bytes reduces a key of any length to 64 bits; the Bloom filter then
+// treats that value as a 64-bit key. The key is read as little-endian 64-bit
+// words, the last one zero-padded. Each word goes through the xxHash3
+// accumulate step, acc += swap32(x) + lo32(x) * hi32(x) with x = word ^ secret,
+// which only needs 32x32->64-bit multiplies, so AVX2 can run it for four keys
+// at once in the 64-bit lanes of a register. After every 64-byte stripe the
+// accumulator is scrambled so that words of different stripes do not commute,
+// and the result gets a full bf_mix64 avalanche. The scalar and AVX2 paths
+// compute the same value.
+
+#define BF_BYTES_PRIME32 0x9E3779B1ULL
+#define BF_BYTES_LANES 4
+
+static const uint64_t bf_secret[8] = {
+    0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL, 0x1F67B3B7A4A44072ULL,
+    0x78E5C0CC4EE679CBULL, 0x2172FFCC7DD05A82ULL, 0x8E2443F7744608B8ULL, 0x4C263A81E69035E0ULL
+};
+
+static inline uint64_t bf_bytes_init(size_t len, uint64_t seed) {
+    return seed ^ ((uint64_t)len * 0x9E3779B185EBCA87ULL);
+}
+
+static inline uint64_t bf_bytes_round(uint64_t acc, uint64_t word, size_t i) {
+    uint64_t x = word ^ bf_secret[i % 8];
+    acc += ((x << 32) | (x >> 32)) + (x & 0xFFFFFFFFULL) * (x >> 32);
+    if (i % 8 == 7) {
+        acc ^= acc >> 47;
+        acc *= BF_BYTES_PRIME32;
+    }
+    return acc;
+}
+
+/**
+ * @brief Reads word i of a key of 'len' >= 8 bytes, zero-padded past the end.
+ * * The last, partial word is read as the key's final 8 bytes shifted down, so
+ * no byte outside the key is touched and no variable-length copy is needed.
+ */
+static inline uint64_t bf_bytes_word(const unsigned char *p, size_t len, size_t i) {
+    uint64_t word;
+    if (8 * i + 8 <= len) {
+        memcpy(&word, p + 8 * i, sizeof(word));
+        return word;
+    }
+    memcpy(&word, p + len - 8, sizeof(word));
+    return word >> (8 * (8 * i + 8 - len));
+}
+
+uint64_t bf_hash_bytes(const void *key, size_t len, uint64_t seed) {
+    const unsigned char *p = key;
+    uint64_t acc = bf_bytes_init(len, seed);
+    if (len < 8) {
+        uint64_t word = 0;
+        memcpy(&word, p, len);
+        return bf_mix64(len ? bf_bytes_round(acc, word, 0) : acc);
+    }
+    size_t num_words = (len + 7) / 8;
+    for (size_t i = 0; i < num_words; i++) {
+        acc = bf_bytes_round(acc, bf_bytes_word(p, len, i), i);
+    }
+    return bf_mix64(acc);
+}
+
+#if defined(__AVX2__)
+
+/**
+ * @brief Lane-wise 64 x 64-bit multiply (low 64 bits) from three 32 x 32-bit multiplies.
+ */
+static inline __m256i bf_mul64_epi64(__m256i a, __m256i b) {
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)),
+                                     _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b));
+    return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+}
+
+/**
+ * @brief Hashes four keys of at least 8 bytes each, one per 64-bit lane.
+ * * Lanes whose key has no word i left are masked out of step i.
+ */
+static void bf_hash_bytes_x4(const void *const keys[], const size_t lens[], uint64_t seed, uint64_t out[]) {
+    const unsigned char *p0 = keys[0], *p1 = keys[1], *p2 = keys[2], *p3 = keys[3];
+    size_t max_len = lens[0];
+    for (int j = 1; j < BF_BYTES_LANES; j++) {
+        if (lens[j] > max_len) max_len = lens[j];
+    }
+
+    const __m256i len = _mm256_setr_epi64x((long long)lens[0], (long long)lens[1],
+                                           (long long)lens[2], (long long)lens[3]);
+    const __m256i prime = _mm256_set1_epi64x((long long)BF_BYTES_PRIME32);
+    __m256i acc = _mm256_xor_si256(_mm256_set1_epi64x((long long)seed),
+                                   bf_mul64_epi64(len, _mm256_set1_epi64x((long long)0x9E3779B185EBCA87ULL)));
+
+    for (size_t i = 0, start = 0; start < max_len; i++, start += 8) {
+        // Word i of each lane is its 8 bytes at min(start, len - 8), shifted down past the end.
+        uint64_t w0, w1, w2, w3;
+        memcpy(&w0, p0 + (start + 8 <= lens[0] ? start : lens[0] - 8), sizeof(uint64_t));
+        memcpy(&w1, p1 + (start + 8 <= lens[1] ? start : lens[1] - 8), sizeof(uint64_t));
+        memcpy(&w2, p2 + (start + 8 <= lens[2] ? start : lens[2] - 8), sizeof(uint64_t));
+        memcpy(&w3, p3 + (start + 8 <= lens[3] ? start : lens[3] - 8), sizeof(uint64_t));
+        __m256i end = _mm256_set1_epi64x((long long)(start + 8));
+        __m256i overhang = _mm256_and_si256(_mm256_cmpgt_epi64(end, len), _mm256_sub_epi64(end, len));
+        __m256i active = _mm256_cmpgt_epi64(len, _mm256_set1_epi64x((long long)start));
+        __m256i word = _mm256_srlv_epi64(_mm256_setr_epi64x((long long)w0, (long long)w1, (long long)w2, (long long)w3),
+                                         _mm256_slli_epi64(overhang, 3));
+
+        __m256i x = _mm256_xor_si256(word, _mm256_set1_epi64x((long long)bf_secret[i % 8]));
+        __m256i swapped = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+        __m256i product = _mm256_mul_epu32(x, _mm256_srli_epi64(x, 32));
+        acc = _mm256_add_epi64(acc, _mm256_and_si256(active, _mm256_add_epi64(swapped, product)));
+        if (i % 8 == 7) {
+            __m256i scrambled = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+            scrambled = _mm256_add_epi64(_mm256_mul_epu32(scrambled, prime),
+                                         _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(scrambled, 32), prime), 32));
+            acc = _mm256_blendv_epi8(acc, scrambled, active);
+        }
+    }
+
+    // bf_mix64, lane-wise.
+    acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 33));
+    acc = bf_mul64_epi64(acc, _mm256_set1_epi64x((long long)0xFF51AFD7ED558CCDULL));
+    acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 33));
+    acc = bf_mul64_epi64(acc, _mm256_set1_epi64x((long long)0xC4CEB9FE1A85EC53ULL));
+    acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 33));
+    _mm256_storeu_si256((__m256i *)out, acc);
+}
+
+#endif
+
+void bf_hash_bytes_batch(const void *const keys[], const size_t lens[], size_t n, uint64_t seed, uint64_t out[]) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + BF_BYTES_LANES <= n; i += BF_BYTES_LANES) {
+        if (lens[i] < 8 || lens[i + 1] < 8 || lens[i + 2] < 8 || lens[i + 3] < 8) {
+            for (int j = 0; j < BF_BYTES_LANES; j++) {
+                out[i + j] = bf_hash_bytes(keys[i + j], lens[i + j], seed);
+            }
+        } else {
+            bf_hash_bytes_x4(keys + i, lens + i, seed, out + i);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = bf_hash_bytes(keys[i], lens[i], seed);
+    }
+}
+
+void bf_insert_bytes(BloomFilter64 *bf, const void *key, size_t len) {
+    bf_insert_u64(bf, bf_hash_bytes(key, len, bf->seed));
+}
+
+bool bf_member_bytes(const BloomFilter64 *bf, const void *key, size_t len) {
+    return bf_member_u64(bf, bf_hash_bytes(key, len, bf->seed));
+}
+
+#define BF_BYTES_WINDOW 64
+
+void bf_insert_bytes_batch(BloomFilter64 *bf, const void *const keys[], const size_t lens[], size_t n) {
+    uint64_t hashes[BF_BYTES_WINDOW];
+    for (size_t base = 0; base < n; base += BF_BYTES_WINDOW) {
+        size_t count = n - base < BF_BYTES_WINDOW ? n - base : BF_BYTES_WINDOW;
+        bf_hash_bytes_batch(keys + base, lens + base, count, bf->seed, hashes);
+        bf_insert_batch(bf, hashes, count);
+    }
+}
+
+void bf_member_bytes_batch(const BloomFilter64 *bf, const void *const keys[], const size_t lens[], size_t n,
+                           uint64_t out_bitmap[]) {
+    // A window of 64 keys fills exactly one bitmap word.
+    uint64_t hashes[BF_BYTES_WINDOW];
+    for (size_t base = 0; base < n; base += BF_BYTES_WINDOW) {
+        size_t count = n - base < BF_BYTES_WINDOW ? n - base : BF_BYTES_WINDOW;
+        bf_hash_bytes_batch(keys + base, lens + base, count, bf->seed, hashes);
+        bf_member_batch(bf, hashes, count, &out_bitmap[base / 64]);
+    }
+}
@@ -0,0 +1,173 @@
+/*
+ *  Runtime-sized Bloom filter over 64-bit keys (see section 5 of bloom_filter.c).
+ *
+ *  Snapshot file layout (all integers little-endian):
+ *
+ *    BloomFileHeader                48 bytes, zero-padded to 64
+ *    bits     uint64_t[num_bits / 64]
+ */
+
+#ifndef TEMPLATE_BLOOM_FILTER_H
+#define TEMPLATE_BLOOM_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BLOOM_FILE_MAGIC "BLOOMF64"
+#define BLOOM_FILE_VERSION 1
+#define BF_MAX_HASHES 64        ///< Upper bound on k; snapshots with a larger k are rejected.
+
+typedef struct {
+    char magic[8];            ///< BLOOM_FILE_MAGIC, not NUL-terminated.
+    uint32_t version;         ///< BLOOM_FILE_VERSION.
+    uint32_t num_hashes;      ///< k
+    uint64_t num_bits;        ///< m, a multiple of 64.
+    uint64_t seed;            ///< Hash seed; filters only combine with equal seeds.
+    uint64_t checksum;        ///< Checksum of the bit array.
+    uint64_t reserved;
+} BloomFileHeader;
+
+typedef struct BloomFilter64 BloomFilter64;
+
+/**
+ * @brief Strong 64-bit mixer (the MurmurHash3 finalizer): every input bit affects every output bit.
+ */
+static inline uint64_t bf_mix64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+#define BF_DEFAULT_SEED 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief Maps a 64-bit hash uniformly onto [0, n) with a multiply instead of a division.
+ */
+static inline uint64_t bf_reduce(uint64_t x, uint64_t n) {
+    return (uint64_t)(((unsigned __int128)x * n) >> 64);
+}
+
+/**
+ * @brief Derives the two double-hashing values from a single mix of the key.
+ * * Probe i is bf_reduce(h1 + i * h2, m). bf_reduce uses the high bits of each
+ * probe, so h2 takes the (independent) low half of the hash as its high half.
+ * It is odd so that it is never 0.
+ */
+static inline void bf_hash_pair(uint64_t key, uint64_t seed, uint64_t *h1, uint64_t *h2) {
+    uint64_t h = bf_mix64(key ^ seed);
+    *h1 = h;
+    *h2 = ((h << 32) | (h >> 32)) | 1;
+}
+
+/**
+ * @brief Computes the optimal size for ('expected_n', 'target_fpr'): m = -n ln(p) / ln(2)^2, k = (m / n) ln(2).
+ * @param num_words Receives m / 64 (m rounded up to whole 64-bit words).
+ * @param num_hashes Receives k (at least 1, at most BF_MAX_HASHES).
+ * @return int 0 on success, -1 if the arguments are out of range.
+ */
+int bf_optimal_params(size_t expected_n, double target_fpr, uint64_t *num_words, int *num_hashes);
+
+/**
+ * @brief Creates a filter sized for 'expected_n' keys at false-positive rate 'target_fpr'.
+ * * Picks the optimal m = -n ln(p) / ln(2)^2 bits and k = (m / n) ln(2) probes.
+ * @param expected_n The number of keys the filter is sized for (at least 1).
+ * @param target_fpr The desired false-positive rate, in (0, 1).
+ * @return BloomFilter64* The new filter, or NULL on failure.
+ */
+BloomFilter64 *bf_create(size_t expected_n, double target_fpr);
+/**
+ * @brief Frees all memory associated with the filter.
+ */
+void bf_free(BloomFilter64 *bf);
+/**
+ * @brief Inserts a 64-bit key. The key is hashed once; the k probes come from double hashing.
+ */
+void bf_insert_u64(BloomFilter64 *bf, uint64_t key);
+/**
+ * @brief Checks a 64-bit key.
+ * @return bool true ("Maybe") if all k bits are set, false ("No") otherwise.
+ */
+bool bf_member_u64(const BloomFilter64 *bf, uint64_t key);
+/**
+ * @brief Inserts keys[0..n), hashing a window of keys ahead and prefetching their probe words.
+ */
+void bf_insert_batch(BloomFilter64 *bf, const uint64_t keys[], size_t n);
+/**
+ * @brief Checks keys[0..n) like bf_member_u64, overlapping the cache misses of many keys.
+ * @param out_bitmap Receives (n + 63) / 64 words; bit i (word i / 64, bit i % 64) is set if keys[i] may be a member.
+ */
+void bf_member_batch(const BloomFilter64 *bf, const uint64_t keys[], size_t n, uint64_t out_bitmap[]);
+/**
+ * @brief Hashes a byte string of any length to 64 bits (alignment-free, little-endian words).
+ */
+uint64_t bf_hash_bytes(const void *key, size_t len, uint64_t seed);
+/**
+ * @brief bf_hash_bytes for keys[0..n), four keys at a time in the SIMD lanes when AVX2 is available.
+ */
+void bf_hash_bytes_batch(const void *const keys[], const size_t lens[], size_t n, uint64_t seed, uint64_t out[]);
+/**
+ * @brief Inserts a byte-string key (hashed with bf_hash_bytes, then inserted as a 64-bit key).
+ */
+void bf_insert_bytes(BloomFilter64 *bf, const void *key, size_t len);
+/**
+ * @brief Checks a byte-string key.
+ * @return bool true ("Maybe") if all k bits are set, false ("No") otherwise.
+ */
+bool bf_member_bytes(const BloomFilter64 *bf, const void *key, size_t len);
+/**
+ * @brief Inserts the byte-string keys[0..n) of lengths lens[0..n), hashed in SIMD batches and prefetched.
+ */
+void bf_insert_bytes_batch(BloomFilter64 *bf, const void *const keys[], const size_t lens[], size_t n);
+/**
+ * @brief Checks the byte-string keys[0..n) at once.
+ * @param out_bitmap Receives (n + 63) / 64 words, laid out as for bf_member_batch.
+ */
+void bf_member_bytes_batch(const BloomFilter64 *bf, const void *const keys[], const size_t lens[], size_t n,
+                           uint64_t out_bitmap[]);
+/**
+ * @brief Returns the size of the bit array (m).
+ */
+uint64_t bf_num_bits(const BloomFilter64 *bf);
+/**
+ * @brief Returns the number of probes per key (k).
+ */
+int bf_num_hashes(const BloomFilter64 *bf);
+/**
+ * @brief Writes the filter to a versioned snapshot file.
+ * @return int 0 on success, -1 on failure.
+ */
+int bf_snapshot_save(const BloomFilter64 *bf, const char *path);
+/**
+ * @brief Maps a snapshot into memory; it can be queried immediately, nothing is copied.
+ * * The mapping is private and copy-on-write, so inserting into the loaded
+ * filter (or using it as a bf_union destination) never changes the file.
+ * @param verify Whether to check the bit array against the stored checksum (reads the whole file).
+ * @return BloomFilter64* The filter, or NULL if the file cannot be opened or is malformed.
+ */
+BloomFilter64 *bf_snapshot_open(const char *path, bool verify);
+/**
+ * @brief Returns true if the two filters have the same size, probe count and seed.
+ */
+bool bf_compatible(const BloomFilter64 *a, const BloomFilter64 *b);
+/**
+ * @brief dst |= src, word-wise: dst then answers "Maybe" for every key of either filter.
+ * @return int 0 on success, -1 if the filters are not compatible.
+ */
+int bf_union(BloomFilter64 *dst, const BloomFilter64 *src);
+/**
+ * @brief dst &= src, word-wise: dst then answers "Maybe" for every key of both filters.
+ * * The result may have a higher false-positive rate than a filter built from
+ * the intersection of the key sets.
+ * @return int 0 on success, -1 if the filters are not compatible.
+ */
+int bf_intersect(BloomFilter64 *dst, const BloomFilter64 *src);
+/**
+ * @brief Returns the theoretical false-positive rate (1 - e^(-kn/m))^k after 'n' distinct inserts.
+ */
+double bf_theoretical_fpr(const BloomFilter64 *bf, size_t n);
+
+#endif //TEMPLATE_BLOOM_FILTER_H
@@ -0,0 +1,151 @@
+/*
+ *  Multi-threaded insert benchmark: concurrent Bloom filter against a mutex around bf_insert_u64.
+ *  Usage: concurrent-bloom-bench [num_keys] [max_threads] [num_queries]
+ *         (default: 50M keys at 1% FPR, up to 16 threads, 10M queries)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "bloom_filter.h"
+#include "concurrent_bloom_filter.h"
+#include "bench_util.h"
+
+#define TARGET_FPR 0.01
+#define BATCH_SIZE 1024
+
+typedef struct {
+    BloomFilter64 *bf;
+    ConcurrentBloomFilter *cbf;
+    pthread_mutex_t *lock;
+    size_t begin, end;
+} Range;
+
+/**
+ * @brief The i-th key: a SplitMix64 output, distinct for distinct i.
+ */
+static uint64_t key_of(uint64_t i) {
+    return splitmix64_mix((i + 1) * 0x9E3779B97F4A7C15ULL);
+}
+
+static void *insert_locked(void *arg) {
+    Range *range = arg;
+    for (size_t i = range->begin; i < range->end; i++) {
+        uint64_t key = key_of(i);
+        pthread_mutex_lock(range->lock);
+        bf_insert_u64(range->bf, key);
+        pthread_mutex_unlock(range->lock);
+    }
+    return NULL;
+}
+
+static void *insert_atomic(void *arg) {
+    Range *range = arg;
+    for (size_t i = range->begin; i < range->end; i++) {
+        cbf_insert(range->cbf, key_of(i));
+    }
+    return NULL;
+}
+
+static void *insert_atomic_batch(void *arg) {
+    Range *range = arg;
+    uint64_t keys[BATCH_SIZE];
+    for (size_t i = range->begin; i < range->end; i += BATCH_SIZE) {
+        size_t count = range->end - i < BATCH_SIZE ? range->end - i : BATCH_SIZE;
+        for (size_t j = 0; j < count; j++) {
+            keys[j] = key_of(i + j);
+        }
+        cbf_insert_batch(range->cbf, keys, count);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Checks that 'cbf' holds every key and answers the query stream exactly like the sequential filter.
+ */
+static int lost_updates(const ConcurrentBloomFilter *cbf, size_t num_keys, size_t num_queries, size_t expected_fp) {
+    size_t missing = 0, false_positives = 0;
+    for (size_t i = 0; i < num_keys; i++) {
+        missing += !cbf_member(cbf, key_of(i));
+    }
+    for (size_t q = 0; q < num_queries; q++) {
+        false_positives += cbf_member(cbf, key_of(num_keys + q));
+    }
+    return missing || false_positives != expected_fp;
+}
+
+/**
+ * @brief Splits [0, num_keys) over 'num_threads' threads running 'body' and returns the wall time.
+ */
+static double run_threads(void *(*body)(void *), Range *ranges, pthread_t *threads, int num_threads,
+                          size_t num_keys) {
+    size_t chunk = (num_keys + (size_t)num_threads - 1) / (size_t)num_threads;
+    double start = now_sec();
+    for (int t = 0; t < num_threads; t++) {
+        ranges[t].begin = chunk * t < num_keys ? chunk * t : num_keys;
+        ranges[t].end = chunk * (t + 1) < num_keys ? chunk * (t + 1) : num_keys;
+        pthread_create(&threads[t], NULL, body, &ranges[t]);
+    }
+    for (int t = 0; t < num_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return now_sec() - start;
+}
+
+int main(int argc, char *argv[]) {
+    size_t num_keys = argc > 1 ? strtoull(argv[1], NULL, 10) : 50000000;
+    int max_threads = argc > 2 ? atoi(argv[2]) : 16;
+    size_t num_queries = argc > 3 ? strtoull(argv[3], NULL, 10) : 10000000;
+    if (max_threads > 256) max_threads = 256;
+
+    // Sequential reference: the concurrent filter probes the same bits, so it must answer identically.
+    BloomFilter64 *reference = bf_create(num_keys, TARGET_FPR);
+    if (!reference) return 1;
+    double start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        bf_insert_u64(reference, key_of(i));
+    }
+    double seq_time = now_sec() - start;
+    size_t expected_fp = 0;
+    for (size_t q = 0; q < num_queries; q++) {
+        expected_fp += bf_member_u64(reference, key_of(num_keys + q));
+    }
+    bf_free(reference);
+    printf("n=%zu  sequential bf_insert_u64: %.3f s (%.2f M inserts/s)\n", num_keys, seq_time,
+           (double)num_keys / seq_time / 1e6);
+
+    pthread_t threads[256];
+    Range ranges[256];
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    for (int t = 1; t <= max_threads; t *= 2) {
+        BloomFilter64 *bf = bf_create(num_keys, TARGET_FPR);
+        ConcurrentBloomFilter *cbf = cbf_create(num_keys, TARGET_FPR);
+        ConcurrentBloomFilter *cbf_batch = cbf_create(num_keys, TARGET_FPR);
+        if (!bf || !cbf || !cbf_batch) return 1;
+
+        for (int k = 0; k < t; k++) {
+            ranges[k] = (Range){bf, cbf, &lock, 0, 0};
+        }
+        double locked_time = run_threads(insert_locked, ranges, threads, t, num_keys);
+        double atomic_time = run_threads(insert_atomic, ranges, threads, t, num_keys);
+        for (int k = 0; k < t; k++) {
+            ranges[k].cbf = cbf_batch;
+        }
+        double batch_time = run_threads(insert_atomic_batch, ranges, threads, t, num_keys);
+
+        printf("threads=%3d  mutex: %6.2f M/s  atomic: %6.2f M/s  atomic batch: %6.2f M/s%s\n", t,
+               (double)num_keys / locked_time / 1e6, (double)num_keys / atomic_time / 1e6,
+               (double)num_keys / batch_time / 1e6,
+               lost_updates(cbf, num_keys, num_queries, expected_fp) ||
+               lost_updates(cbf_batch, num_keys, num_queries, expected_fp) ? "  LOST UPDATES" : "");
+        bf_free(bf);
+        cbf_free(cbf);
+        cbf_free(cbf_batch);
+    }
+    return 0;
+}
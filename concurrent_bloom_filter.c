@@ -0,0 +1,115 @@
+/*
+ *  Concurrent Bloom filter with atomic bit operations.
+ *
+ *  The bit array is an array of _Atomic uint64_t. An insert sets each probe
+ *  bit with a relaxed fetch-or, which is a single atomic read-modify-write,
+ *  so two threads setting bits of the same word cannot overwrite each other.
+ *  Bits are only ever set, never cleared, so no ordering stronger than relaxed
+ *  is needed: a query is a plain sequence of relaxed loads. Sizing, hashing
+ *  and probe positions are those of BloomFilter64.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "concurrent_bloom_filter.h"
+#include "bloom_filter.h"
+
+#define CBF_BATCH_WINDOW 16
+
+struct ConcurrentBloomFilter {
+    _Atomic uint64_t *words;
+    uint64_t num_bits;
+    int num_hashes;
+    uint64_t seed;
+};
+
+ConcurrentBloomFilter *cbf_create(size_t expected_n, double target_fpr) {
+    uint64_t num_words;
+    int num_hashes;
+    if (bf_optimal_params(expected_n, target_fpr, &num_words, &num_hashes) != 0) {
+        return NULL;
+    }
+
+    ConcurrentBloomFilter *bf = malloc(sizeof(ConcurrentBloomFilter));
+    if (!bf) {
+        fprintf(stderr, "Bloom filter allocation failed!\n");
+        return NULL;
+    }
+    bf->words = malloc(sizeof(_Atomic uint64_t) * num_words);
+    if (!bf->words) {
+        fprintf(stderr, "Bloom filter bit array allocation failed!\n");
+        free(bf);
+        return NULL;
+    }
+    for (uint64_t i = 0; i < num_words; i++) {
+        atomic_init(&bf->words[i], 0);
+    }
+    bf->num_bits = num_words * 64;
+    bf->num_hashes = num_hashes;
+    bf->seed = BF_DEFAULT_SEED;
+    return bf;
+}
+
+void cbf_free(ConcurrentBloomFilter *bf) {
+    if (bf) {
+        free(bf->words);
+        free(bf);
+    }
+}
+
+static inline void cbf_set_probes(ConcurrentBloomFilter *bf, uint64_t h1, uint64_t h2) {
+    for (int i = 0; i < bf->num_hashes; i++) {
+        uint64_t index = bf_reduce(h1, bf->num_bits);
+        _Atomic uint64_t *word = &bf->words[index / 64];
+        uint64_t bit = 1ULL << (index % 64);
+        // Skip the read-modify-write when the bit is already set: in a filter that
+        // is filling up most bits are, and a plain load does not take the line exclusively.
+        if (!(atomic_load_explicit(word, memory_order_relaxed) & bit)) {
+            atomic_fetch_or_explicit(word, bit, memory_order_relaxed);
+        }
+        h1 += h2;
+    }
+}
+
+void cbf_insert(ConcurrentBloomFilter *bf, uint64_t key) {
+    uint64_t h1, h2;
+    bf_hash_pair(key, bf->seed, &h1, &h2);
+    cbf_set_probes(bf, h1, h2);
+}
+
+bool cbf_member(const ConcurrentBloomFilter *bf, uint64_t key) {
+    uint64_t h1, h2;
+    bf_hash_pair(key, bf->seed, &h1, &h2);
+    for (int i = 0; i < bf->num_hashes; i++) {
+        uint64_t index = bf_reduce(h1, bf->num_bits);
+        if (!(atomic_load_explicit(&bf->words[index / 64], memory_order_relaxed) & (1ULL << (index % 64)))) {
+            return false;
+        }
+        h1 += h2;
+    }
+    return true;
+}
+
+void cbf_insert_batch(ConcurrentBloomFilter *bf, const uint64_t keys[], size_t n) {
+    uint64_t h1[CBF_BATCH_WINDOW], h2[CBF_BATCH_WINDOW];
+    for (size_t base = 0; base < n; base += CBF_BATCH_WINDOW) {
+        size_t count = n - base < CBF_BATCH_WINDOW ? n - base : CBF_BATCH_WINDOW;
+        for (size_t j = 0; j < count; j++) {
+            bf_hash_pair(keys[base + j], bf->seed, &h1[j], &h2[j]);
+            uint64_t probe = h1[j];
+            for (int i = 0; i < bf->num_hashes; i++) {
+                __builtin_prefetch((const void *)&bf->words[bf_reduce(probe, bf->num_bits) / 64], 1);
+                probe += h2[j];
+            }
+        }
+        for (size_t j = 0; j < count; j++) {
+            cbf_set_probes(bf, h1[j], h2[j]);
+        }
+    }
+}
+
+uint64_t cbf_num_bits(const ConcurrentBloomFilter *bf) {
+    return bf->num_bits;
+}
@@ -0,0 +1,44 @@
+/*
+ *  Concurrent Bloom filter over 64-bit keys.
+ *  Any number of threads may call cbf_insert / cbf_member (and the batch forms) at once.
+ */
+
+#ifndef TEMPLATE_CONCURRENT_BLOOM_FILTER_H
+#define TEMPLATE_CONCURRENT_BLOOM_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct ConcurrentBloomFilter ConcurrentBloomFilter;
+
+/**
+ * @brief Creates a filter sized like bf_create(expected_n, target_fpr), probing the same bits.
+ * @return ConcurrentBloomFilter* The new filter, or NULL on failure.
+ */
+ConcurrentBloomFilter *cbf_create(size_t expected_n, double target_fpr);
+/**
+ * @brief Frees all memory associated with the filter. Not thread-safe.
+ */
+void cbf_free(ConcurrentBloomFilter *bf);
+/**
+ * @brief Inserts a 64-bit key with relaxed atomic fetch-or, so concurrent inserts never lose bits.
+ */
+void cbf_insert(ConcurrentBloomFilter *bf, uint64_t key);
+/**
+ * @brief Checks a 64-bit key without locks.
+ * * Every insert that happens-before the query (e.g. via a thread join) is
+ * seen; an insert still in flight may be seen partially, i.e. not at all.
+ * @return bool true ("Maybe") if all k bits are set, false ("No") otherwise.
+ */
+bool cbf_member(const ConcurrentBloomFilter *bf, uint64_t key);
+/**
+ * @brief Inserts keys[0..n), prefetching a window of keys ahead like bf_insert_batch.
+ */
+void cbf_insert_batch(ConcurrentBloomFilter *bf, const uint64_t keys[], size_t n);
+/**
+ * @brief Returns the size of the bit array (m).
+ */
+uint64_t cbf_num_bits(const ConcurrentBloomFilter *bf);
+
+#endif //TEMPLATE_CONCURRENT_BLOOM_FILTER_H
@@ -0,0 +1,102 @@
+/*
+ *  Benchmark: cuckoo filter against the runtime-sized Bloom filter at equal memory.
+ *  Usage: cuckoo-bench [num_slots] [fingerprint_bits] [num_queries]
+ *         (default: 16M slots, 16-bit fingerprints, 10M queries)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "bloom_filter.h"
+#include "cuckoo_filter.h"
+#include "bench_util.h"
+
+int main(int argc, char *argv[]) {
+    size_t num_slots = argc > 1 ? strtoull(argv[1], NULL, 10) : (size_t)1 << 24;
+    int fingerprint_bits = argc > 2 ? atoi(argv[2]) : 16;
+    size_t num_queries = argc > 3 ? strtoull(argv[3], NULL, 10) : 10000000;
+    int load_percents[] = {50, 75, 90, 95};
+
+    for (int r = 0; r < 4; r++) {
+        CuckooFilter *cf = cf_create(num_slots, fingerprint_bits);
+        if (!cf) {
+            return 1;
+        }
+        size_t num_keys = (size_t)((double)num_slots * load_percents[r] / 100);
+
+        uint64_t state = 11;
+        size_t failed = 0;
+        double start = now_sec();
+        for (size_t i = 0; i < num_keys; i++) {
+            failed += !cf_insert(cf, next_rand(&state));
+        }
+        double cf_insert_time = now_sec() - start;
+        uint64_t query_state = state;
+
+        // The Bloom filter gets the same number of bits per key.
+        double bits_per_key = (double)cf_num_bits(cf) / (double)num_keys;
+        double ln2 = log(2.0);
+        BloomFilter64 *bf = bf_create(num_keys, exp(-bits_per_key * ln2 * ln2));
+        if (!bf) {
+            return 1;
+        }
+        state = 11;
+        for (size_t i = 0; i < num_keys; i++) {
+            bf_insert_u64(bf, next_rand(&state));
+        }
+
+        size_t cf_false = 0, bf_false = 0;
+        state = query_state;
+        start = now_sec();
+        for (size_t i = 0; i < num_queries; i++) {
+            cf_false += cf_member(cf, next_rand(&state));
+        }
+        double cf_query_time = now_sec() - start;
+        state = query_state;
+        start = now_sec();
+        for (size_t i = 0; i < num_queries; i++) {
+            bf_false += bf_member_u64(bf, next_rand(&state));
+        }
+        double bf_query_time = now_sec() - start;
+
+        size_t cf_missing = 0, bf_missing = 0;
+        state = 11;
+        start = now_sec();
+        for (size_t i = 0; i < num_keys; i++) {
+            cf_missing += !cf_member(cf, next_rand(&state));
+        }
+        double cf_positive_time = now_sec() - start;
+        state = 11;
+        start = now_sec();
+        for (size_t i = 0; i < num_keys; i++) {
+            bf_missing += !bf_member_u64(bf, next_rand(&state));
+        }
+        double bf_positive_time = now_sec() - start;
+
+        size_t not_deleted = 0;
+        state = 11;
+        start = now_sec();
+        for (size_t i = 0; i < num_keys; i++) {
+            not_deleted += !cf_delete(cf, next_rand(&state));
+        }
+        double cf_delete_time = now_sec() - start;
+
+        printf("load %d%%  n=%zu  %.1f bits/key  (%zu inserts failed)\n", load_percents[r], num_keys,
+               bits_per_key, failed);
+        printf("  cuckoo  FPR %.4f%%  insert %6.1f M/s  negative %6.1f M/s  positive %6.1f M/s  delete %6.1f M/s%s\n",
+               100.0 * cf_false / num_queries, num_keys / cf_insert_time / 1e6, num_queries / cf_query_time / 1e6,
+               num_keys / cf_positive_time / 1e6, num_keys / cf_delete_time / 1e6,
+               cf_missing != failed || not_deleted != failed || cf_count(cf) != 0 ? "  MISMATCH" : "");
+        printf("  bloom   FPR %.4f%%  k=%d              negative %6.1f M/s  positive %6.1f M/s%s\n",
+               100.0 * bf_false / num_queries, bf_num_hashes(bf), num_queries / bf_query_time / 1e6,
+               num_keys / bf_positive_time / 1e6, bf_missing ? "  FALSE NEGATIVES" : "");
+
+        cf_free(cf);
+        bf_free(bf);
+    }
+    return 0;
+}
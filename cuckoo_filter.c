@@ -0,0 +1,206 @@
+/*
+ *  Cuckoo filter (Fan, Andersen, Kaminsky & Mitzenmacher).
+ *
+ *  Each key stores a small fingerprint in one of two 4-slot buckets: i1 from
+ *  the key's hash and i2 = i1 ^ hash(fingerprint). Because i1 can be recovered
+ *  from (i2, fingerprint) the same way, a fingerprint can be moved between its
+ *  buckets without the original key, which makes relocation ("kicking") and
+ *  deletion possible. Slot value 0 marks an empty slot, so fingerprints are
+ *  never 0. A bucket is read as one machine word and searched with a SWAR
+ *  zero-lane test.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cuckoo_filter.h"
+#include "bloom_filter.h"
+
+#define CF_SLOTS 4
+#define CF_MAX_KICKS 500
+#define CF_SEED 0x9E3779B97F4A7C15ULL
+
+struct CuckooFilter {
+    uint8_t *table;          ///< num_buckets * CF_SLOTS slots of slot_bytes each.
+    uint64_t num_buckets;    ///< A power of two.
+    int fingerprint_bits;
+    int slot_bytes;          ///< 1 for fingerprints up to 8 bits, 2 up to 16 bits.
+    size_t count;
+    uint64_t seed;
+    uint64_t kick_state;     ///< xorshift state for choosing the slot to evict.
+};
+
+CuckooFilter *cf_create(size_t capacity, int fingerprint_bits) {
+    if (capacity == 0 || fingerprint_bits < 8 || fingerprint_bits > 16) {
+        fprintf(stderr, "Cuckoo filter needs capacity > 0 and 8 to 16 fingerprint bits!\n");
+        return NULL;
+    }
+    uint64_t num_buckets = 1;
+    while (num_buckets * CF_SLOTS < capacity) {
+        num_buckets *= 2;
+    }
+
+    CuckooFilter *cf = malloc(sizeof(CuckooFilter));
+    if (!cf) {
+        fprintf(stderr, "Cuckoo filter allocation failed!\n");
+        return NULL;
+    }
+    cf->slot_bytes = fingerprint_bits <= 8 ? 1 : 2;
+    cf->table = calloc(num_buckets * CF_SLOTS, cf->slot_bytes);
+    if (!cf->table) {
+        fprintf(stderr, "Cuckoo filter table allocation failed!\n");
+        free(cf);
+        return NULL;
+    }
+    cf->num_buckets = num_buckets;
+    cf->fingerprint_bits = fingerprint_bits;
+    cf->count = 0;
+    cf->seed = CF_SEED;
+    cf->kick_state = 0x2545F4914F6CDD1DULL;
+    return cf;
+}
+
+void cf_free(CuckooFilter *cf) {
+    if (cf) {
+        free(cf->table);
+        free(cf);
+    }
+}
+
+// --- Slot access ---
+
+static inline uint32_t cf_get(const CuckooFilter *cf, uint64_t bucket, int slot) {
+    size_t i = bucket * CF_SLOTS + slot;
+    return cf->slot_bytes == 1 ? cf->table[i] : ((const uint16_t *)cf->table)[i];
+}
+
+static inline void cf_set(CuckooFilter *cf, uint64_t bucket, int slot, uint32_t fingerprint) {
+    size_t i = bucket * CF_SLOTS + slot;
+    if (cf->slot_bytes == 1) {
+        cf->table[i] = (uint8_t)fingerprint;
+    } else {
+        ((uint16_t *)cf->table)[i] = (uint16_t)fingerprint;
+    }
+}
+
+/**
+ * @brief Returns a nonzero mask if any of the 4 slots of 'bucket' holds 'fingerprint'.
+ * * The bucket is loaded as one word; XOR with the broadcast fingerprint turns
+ * matching slots into zero lanes, which the classic has-zero trick detects.
+ */
+static inline uint64_t cf_bucket_has(const CuckooFilter *cf, uint64_t bucket, uint32_t fingerprint) {
+    if (cf->slot_bytes == 1) {
+        uint32_t word;
+        memcpy(&word, cf->table + bucket * CF_SLOTS, sizeof(word));
+        word ^= fingerprint * 0x01010101U;
+        return (word - 0x01010101U) & ~word & 0x80808080U;
+    }
+    uint64_t word;
+    memcpy(&word, cf->table + bucket * CF_SLOTS * 2, sizeof(word));
+    word ^= fingerprint * 0x0001000100010001ULL;
+    return (word - 0x0001000100010001ULL) & ~word & 0x8000800080008000ULL;
+}
+
+// --- Hashing ---
+
+static inline void cf_hash(const CuckooFilter *cf, uint64_t key, uint32_t *fingerprint, uint64_t *bucket) {
+    uint64_t h = bf_mix64(key ^ cf->seed);
+    uint32_t fp = (uint32_t)(h >> 32) & ((1U << cf->fingerprint_bits) - 1);
+    *fingerprint = fp ? fp : 1;
+    *bucket = h & (cf->num_buckets - 1);
+}
+
+static inline uint64_t cf_alt_bucket(const CuckooFilter *cf, uint64_t bucket, uint32_t fingerprint) {
+    return (bucket ^ (fingerprint * 0x5BD1E995ULL)) & (cf->num_buckets - 1);
+}
+
+static inline int cf_try_place(CuckooFilter *cf, uint64_t bucket, uint32_t fingerprint) {
+    for (int slot = 0; slot < CF_SLOTS; slot++) {
+        if (cf_get(cf, bucket, slot) == 0) {
+            cf_set(cf, bucket, slot, fingerprint);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// --- Public API ---
+
+bool cf_insert(CuckooFilter *cf, uint64_t key) {
+    uint32_t fingerprint;
+    uint64_t bucket;
+    cf_hash(cf, key, &fingerprint, &bucket);
+    uint64_t alt = cf_alt_bucket(cf, bucket, fingerprint);
+    if (cf_try_place(cf, bucket, fingerprint) || cf_try_place(cf, alt, fingerprint)) {
+        cf->count++;
+        return true;
+    }
+
+    // Kick random residents along a path; remember it so a failure can be undone.
+    uint64_t path_bucket[CF_MAX_KICKS];
+    int path_slot[CF_MAX_KICKS];
+    cf->kick_state ^= cf->kick_state << 13;
+    cf->kick_state ^= cf->kick_state >> 7;
+    cf->kick_state ^= cf->kick_state << 17;
+    bucket = (cf->kick_state & 1) ? alt : bucket;
+
+    for (int kick = 0; kick < CF_MAX_KICKS; kick++) {
+        cf->kick_state ^= cf->kick_state << 13;
+        cf->kick_state ^= cf->kick_state >> 7;
+        cf->kick_state ^= cf->kick_state << 17;
+        int slot = (int)(cf->kick_state % CF_SLOTS);
+        uint32_t victim = cf_get(cf, bucket, slot);
+        cf_set(cf, bucket, slot, fingerprint);
+        path_bucket[kick] = bucket;
+        path_slot[kick] = slot;
+
+        fingerprint = victim;
+        bucket = cf_alt_bucket(cf, bucket, fingerprint);
+        if (cf_try_place(cf, bucket, fingerprint)) {
+            cf->count++;
+            return true;
+        }
+    }
+
+    // Table is too full: swap everything back so that no stored fingerprint is lost.
+    for (int kick = CF_MAX_KICKS - 1; kick >= 0; kick--) {
+        uint32_t resident = cf_get(cf, path_bucket[kick], path_slot[kick]);
+        cf_set(cf, path_bucket[kick], path_slot[kick], fingerprint);
+        fingerprint = resident;
+    }
+    return false;
+}
+
+bool cf_member(const CuckooFilter *cf, uint64_t key) {
+    uint32_t fingerprint;
+    uint64_t bucket;
+    cf_hash(cf, key, &fingerprint, &bucket);
+    return (cf_bucket_has(cf, bucket, fingerprint) |
+            cf_bucket_has(cf, cf_alt_bucket(cf, bucket, fingerprint), fingerprint)) != 0;
+}
+
+bool cf_delete(CuckooFilter *cf, uint64_t key) {
+    uint32_t fingerprint;
+    uint64_t bucket;
+    cf_hash(cf, key, &fingerprint, &bucket);
+    uint64_t candidates[2] = {bucket, cf_alt_bucket(cf, bucket, fingerprint)};
+    for (int c = 0; c < 2; c++) {
+        for (int slot = 0; slot < CF_SLOTS; slot++) {
+            if (cf_get(cf, candidates[c], slot) == fingerprint) {
+                cf_set(cf, candidates[c], slot, 0);
+                cf->count--;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t cf_count(const CuckooFilter *cf) {
+    return cf->count;
+}
+
+uint64_t cf_num_bits(const CuckooFilter *cf) {
+    return cf->num_buckets * CF_SLOTS * cf->slot_bytes * 8;
+}
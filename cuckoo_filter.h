@@ -0,0 +1,53 @@
+/*
+ *  Cuckoo filter over 64-bit keys: an approximate set with deletion.
+ */
+
+#ifndef TEMPLATE_CUCKOO_FILTER_H
+#define TEMPLATE_CUCKOO_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct CuckooFilter CuckooFilter;
+
+/**
+ * @brief Creates a filter with room for at least 'capacity' fingerprints (4 per bucket).
+ * * The false-positive rate at load factor a is about 8a / 2^fingerprint_bits.
+ * Inserts start to fail at a load factor of roughly 95%. Fingerprints of up
+ * to 8 bits take one byte per slot, wider ones two bytes.
+ * @param capacity The number of fingerprint slots wanted (rounded up to a power of two).
+ * @param fingerprint_bits The fingerprint width, 8 to 16 bits.
+ * @return CuckooFilter* The new filter, or NULL on failure.
+ */
+CuckooFilter *cf_create(size_t capacity, int fingerprint_bits);
+/**
+ * @brief Frees all memory associated with the filter.
+ */
+void cf_free(CuckooFilter *cf);
+/**
+ * @brief Inserts a 64-bit key, relocating fingerprints between their two buckets if needed.
+ * @return bool true on success, false if the filter is full (nothing is lost; the key is not added).
+ */
+bool cf_insert(CuckooFilter *cf, uint64_t key);
+/**
+ * @brief Checks a 64-bit key, reading at most two buckets.
+ * @return bool true ("Maybe") if a matching fingerprint is stored, false ("No") otherwise.
+ */
+bool cf_member(const CuckooFilter *cf, uint64_t key);
+/**
+ * @brief Deletes one copy of a previously inserted key.
+ * * Deleting a key that was never inserted may remove a colliding key's fingerprint.
+ * @return bool true if a matching fingerprint was removed, false otherwise.
+ */
+bool cf_delete(CuckooFilter *cf, uint64_t key);
+/**
+ * @brief Returns the number of stored fingerprints.
+ */
+size_t cf_count(const CuckooFilter *cf);
+/**
+ * @brief Returns the memory used by the fingerprint table in bits.
+ */
+uint64_t cf_num_bits(const CuckooFilter *cf);
+
+#endif //TEMPLATE_CUCKOO_FILTER_H
@@ -0,0 +1,148 @@
+/*
+ *  Scalable Bloom filter (Almeida, Baquero, Preguica & Hutchison).
+ *
+ *  A chain of BloomFilter64 stages. Stage i is sized for initial_capacity * s^i
+ *  keys at false-positive rate p0 * r^i (growth s = 2, tightening r = 0.85, the
+ *  paper's recommended range), and a new stage is added when the newest one has
+ *  received as many keys as it was sized for. A query is a false positive if
+ *  any stage answers "Maybe", so the overall rate is bounded by the sum
+ *  p0 * (1 + r + r^2 + ...) = p0 / (1 - r); choosing p0 = target * (1 - r)
+ *  keeps it below the target. The newest stage, which holds about half of the
+ *  keys, is checked first.
+ *
+ *  Memory is not a constant factor of a flat filter: with L earlier stages,
+ *  every stage costs at most (ln(1/p0) + L ln(1/r)) / ln(2)^2 bits per key of
+ *  capacity, and just after a stage is added the capacity is up to s times the
+ *  key count. For a 1% target after 10 doublings that is about 17 bits per key
+ *  just before a new stage and up to about 34 just after it, against 9.6 for a
+ *  flat filter sized in advance. sbf_bits_per_key_bound computes this bound.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "scalable_bloom_filter.h"
+#include "bloom_filter.h"
+
+#define SBF_GROWTH 2          ///< Capacity ratio between consecutive stages.
+#define SBF_TIGHTENING 0.85   ///< False-positive ratio between consecutive stages.
+
+struct ScalableBloomFilter {
+    BloomFilter64 **stages;
+    int num_stages;
+    int stage_capacity;     ///< Allocated length of stages[].
+    size_t next_size;       ///< Keys the newest stage is sized for.
+    size_t next_count;      ///< Keys inserted into the newest stage.
+    double next_fpr;        ///< False-positive rate of the newest stage.
+    size_t initial_size;    ///< Keys the first stage is sized for.
+    double initial_fpr;     ///< p0, the false-positive rate of the first stage.
+    size_t num_keys;        ///< Keys inserted into all stages.
+};
+
+/**
+ * @brief Appends a stage sized for 'size' keys at false-positive rate 'fpr' and makes it the newest.
+ */
+static int sbf_add_stage(ScalableBloomFilter *sbf, size_t size, double fpr) {
+    if (sbf->num_stages == sbf->stage_capacity) {
+        int new_capacity = sbf->stage_capacity * 2;
+        BloomFilter64 **stages = realloc(sbf->stages, sizeof(BloomFilter64 *) * new_capacity);
+        if (!stages) {
+            fprintf(stderr, "Scalable Bloom filter stage allocation failed!\n");
+            return -1;
+        }
+        sbf->stages = stages;
+        sbf->stage_capacity = new_capacity;
+    }
+    BloomFilter64 *stage = bf_create(size, fpr);
+    if (!stage) {
+        return -1;
+    }
+    sbf->stages[sbf->num_stages++] = stage;
+    sbf->next_size = size;
+    sbf->next_count = 0;
+    sbf->next_fpr = fpr;
+    return 0;
+}
+
+ScalableBloomFilter *sbf_create(size_t initial_capacity, double target_fpr) {
+    if (initial_capacity == 0 || !(target_fpr > 0.0 && target_fpr < 1.0)) {
+        fprintf(stderr, "Bloom filter needs initial_capacity > 0 and 0 < target_fpr < 1!\n");
+        return NULL;
+    }
+
+    ScalableBloomFilter *sbf = malloc(sizeof(ScalableBloomFilter));
+    if (!sbf) {
+        fprintf(stderr, "Scalable Bloom filter allocation failed!\n");
+        return NULL;
+    }
+    sbf->stage_capacity = 8;
+    sbf->num_stages = 0;
+    sbf->initial_size = initial_capacity;
+    sbf->initial_fpr = target_fpr * (1 - SBF_TIGHTENING);
+    sbf->num_keys = 0;
+    sbf->stages = malloc(sizeof(BloomFilter64 *) * sbf->stage_capacity);
+    if (!sbf->stages || sbf_add_stage(sbf, initial_capacity, sbf->initial_fpr) != 0) {
+        fprintf(stderr, "Scalable Bloom filter allocation failed!\n");
+        sbf_free(sbf);
+        return NULL;
+    }
+    return sbf;
+}
+
+void sbf_free(ScalableBloomFilter *sbf) {
+    if (sbf) {
+        for (int i = 0; i < sbf->num_stages; i++) {
+            bf_free(sbf->stages[i]);
+        }
+        free(sbf->stages);
+        free(sbf);
+    }
+}
+
+int sbf_insert(ScalableBloomFilter *sbf, uint64_t key) {
+    if (sbf->next_count == sbf->next_size &&
+        sbf_add_stage(sbf, sbf->next_size * SBF_GROWTH, sbf->next_fpr * SBF_TIGHTENING) != 0) {
+        return -1;
+    }
+    bf_insert_u64(sbf->stages[sbf->num_stages - 1], key);
+    sbf->next_count++;
+    sbf->num_keys++;
+    return 0;
+}
+
+bool sbf_member(const ScalableBloomFilter *sbf, uint64_t key) {
+    for (int i = sbf->num_stages - 1; i >= 0; i--) {
+        if (bf_member_u64(sbf->stages[i], key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int sbf_num_stages(const ScalableBloomFilter *sbf) {
+    return sbf->num_stages;
+}
+
+uint64_t sbf_num_bits(const ScalableBloomFilter *sbf) {
+    uint64_t total = 0;
+    for (int i = 0; i < sbf->num_stages; i++) {
+        total += bf_num_bits(sbf->stages[i]);
+    }
+    return total;
+}
+
+double sbf_bits_per_key_bound(const ScalableBloomFilter *sbf) {
+    double ln2 = log(2.0);
+    int newest = sbf->num_stages - 1;
+    double bits_per_capacity = (-log(sbf->initial_fpr) - newest * log(SBF_TIGHTENING)) / (ln2 * ln2);
+    double capacity = 0;
+    double size = (double)sbf->initial_size;
+    for (int i = 0; i <= newest; i++) {
+        capacity += size;
+        size *= SBF_GROWTH;
+    }
+    // Each stage rounds its bit count up to whole 64-bit words.
+    double bits = capacity * bits_per_capacity + 64.0 * sbf->num_stages;
+    return bits / (double)(sbf->num_keys > 0 ? sbf->num_keys : 1);
+}
@@ -0,0 +1,52 @@
+/*
+ *  Scalable Bloom filter over 64-bit keys: grows with the number of keys.
+ */
+
+#ifndef TEMPLATE_SCALABLE_BLOOM_FILTER_H
+#define TEMPLATE_SCALABLE_BLOOM_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct ScalableBloomFilter ScalableBloomFilter;
+
+/**
+ * @brief Creates a filter whose false-positive rate stays below 'target_fpr' however many keys are inserted.
+ * * The first stage holds 'initial_capacity' keys; every further stage holds
+ * twice as many as the previous one at 0.85 times its false-positive rate.
+ * Starting far too small costs memory: see sbf_bits_per_key_bound.
+ * @return ScalableBloomFilter* The new filter, or NULL on failure.
+ */
+ScalableBloomFilter *sbf_create(size_t initial_capacity, double target_fpr);
+/**
+ * @brief Frees all memory associated with the filter.
+ */
+void sbf_free(ScalableBloomFilter *sbf);
+/**
+ * @brief Inserts a 64-bit key into the newest stage, adding a stage when it is full.
+ * @return int 0 on success, -1 if a new stage could not be allocated.
+ */
+int sbf_insert(ScalableBloomFilter *sbf, uint64_t key);
+/**
+ * @brief Checks a 64-bit key against every stage, newest (largest) first.
+ * @return bool true ("Maybe") if some stage may hold the key, false ("No") otherwise.
+ */
+bool sbf_member(const ScalableBloomFilter *sbf, uint64_t key);
+/**
+ * @brief Returns the number of stages.
+ */
+int sbf_num_stages(const ScalableBloomFilter *sbf);
+/**
+ * @brief Returns the total size of all bit arrays.
+ */
+uint64_t sbf_num_bits(const ScalableBloomFilter *sbf);
+/**
+ * @brief Returns an upper bound on sbf_num_bits per inserted key for the current stages.
+ * * With L stages before the newest, this is the total stage capacity times
+ * (ln(1/p0) + L ln(1/0.85)) / ln(2)^2 bits, divided by the key count; right
+ * after a new stage is added, the capacity is about twice the key count.
+ */
+double sbf_bits_per_key_bound(const ScalableBloomFilter *sbf);
+
+#endif //TEMPLATE_SCALABLE_BLOOM_FILTER_H
@@ -0,0 +1,194 @@
+/*
+ *  Xor filter (Graf & Lemire, "Xor Filters: Faster and Smaller Than Bloom and
+ *  Cuckoo Filters").
+ *
+ *  The fingerprint array B has about 1.23 n slots, split into three blocks.
+ *  Key x maps to one slot in each block, h0(x), h1(x) and h2(x), and B is filled
+ *  so that B[h0] ^ B[h1] ^ B[h2] equals the 8-bit fingerprint of x for every
+ *  key in the set. A query recomputes that xor: three memory accesses, no
+ *  branches. Construction peels the 3-hypergraph of keys: a slot hit by exactly
+ *  one key is assigned last to that key, which removes the key and may leave
+ *  other slots with one key. If peeling succeeds for all keys, the keys are
+ *  assigned in reverse peeling order.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xor_filter.h"
+#include "bloom_filter.h"
+
+#define XF_MAX_ATTEMPTS 100
+
+struct XorFilter {
+    uint8_t *fingerprints;
+    uint32_t block_length;
+    uint64_t seed;
+};
+
+typedef struct {
+    uint64_t hash;
+    uint32_t slot;
+} XorPeeled;
+
+static inline uint64_t xf_hash(uint64_t key, uint64_t seed) {
+    return bf_mix64(key + seed);
+}
+
+static inline uint8_t xf_fingerprint(uint64_t hash) {
+    return (uint8_t)(hash ^ (hash >> 32));
+}
+
+/**
+ * @brief Slot of 'hash' in block 'index' (0, 1 or 2), from a different 32-bit slice of the hash each.
+ */
+static inline uint32_t xf_slot(uint64_t hash, int index, uint32_t block_length) {
+    uint64_t rotated = index == 0 ? hash : (hash << (21 * index)) | (hash >> (64 - 21 * index));
+    return (uint32_t)(((uint64_t)(uint32_t)rotated * block_length) >> 32) + (uint32_t)index * block_length;
+}
+
+static int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief One peeling attempt with the filter's current seed.
+ * @return int 1 if every key was peeled (and B is filled), 0 otherwise.
+ */
+static int xf_try_build(XorFilter *xf, const uint64_t keys[], size_t n, uint8_t *count, uint64_t *xor_hash,
+                        uint32_t *queue, XorPeeled *stack) {
+    uint32_t capacity = 3 * xf->block_length;
+    memset(count, 0, capacity);
+    memset(xor_hash, 0, sizeof(uint64_t) * capacity);
+
+    // Every slot keeps the number of keys hitting it and the xor of their hashes,
+    // so a slot with count 1 names its only key.
+    for (size_t i = 0; i < n; i++) {
+        uint64_t hash = xf_hash(keys[i], xf->seed);
+        for (int b = 0; b < 3; b++) {
+            uint32_t slot = xf_slot(hash, b, xf->block_length);
+            if (count[slot] == UINT8_MAX) {
+                return 0; // only a heavily repeated key gets here; the caller then drops duplicates
+            }
+            count[slot]++;
+            xor_hash[slot] ^= hash;
+        }
+    }
+
+    size_t queue_size = 0;
+    for (uint32_t slot = 0; slot < capacity; slot++) {
+        if (count[slot] == 1) {
+            queue[queue_size++] = slot;
+        }
+    }
+    size_t stack_size = 0;
+    while (queue_size > 0 && stack_size < n) {
+        uint32_t slot = queue[--queue_size];
+        if (count[slot] != 1) {
+            continue;
+        }
+        uint64_t hash = xor_hash[slot];
+        stack[stack_size++] = (XorPeeled){hash, slot};
+        for (int b = 0; b < 3; b++) {
+            uint32_t other = xf_slot(hash, b, xf->block_length);
+            count[other]--;
+            xor_hash[other] ^= hash;
+            if (count[other] == 1) {
+                queue[queue_size++] = other;
+            }
+        }
+    }
+    if (stack_size != n) {
+        return 0;
+    }
+
+    memset(xf->fingerprints, 0, capacity);
+    while (stack_size > 0) {
+        XorPeeled peeled = stack[--stack_size];
+        uint8_t value = xf_fingerprint(peeled.hash);
+        for (int b = 0; b < 3; b++) {
+            value ^= xf->fingerprints[xf_slot(peeled.hash, b, xf->block_length)];
+        }
+        // The key's own slot is still 0 here, so this makes the three slots xor to its fingerprint.
+        xf->fingerprints[peeled.slot] = value;
+    }
+    return 1;
+}
+
+XorFilter *xf_build(const uint64_t keys[], size_t n) {
+    if (n > UINT32_MAX / 2) {
+        fprintf(stderr, "Xor filter supports at most %u keys!\n", UINT32_MAX / 2);
+        return NULL;
+    }
+    XorFilter *xf = malloc(sizeof(XorFilter));
+    if (!xf) {
+        fprintf(stderr, "Xor filter allocation failed!\n");
+        return NULL;
+    }
+    uint64_t capacity = 32 + (uint64_t)(1.23 * (double)n);
+    xf->block_length = (uint32_t)(capacity / 3 + 1);
+    xf->seed = BF_DEFAULT_SEED;
+    capacity = 3 * (uint64_t)xf->block_length;
+
+    xf->fingerprints = malloc(capacity);
+    uint8_t *count = malloc(capacity);
+    uint64_t *xor_hash = malloc(sizeof(uint64_t) * capacity);
+    uint32_t *queue = malloc(sizeof(uint32_t) * capacity);
+    XorPeeled *stack = malloc(sizeof(XorPeeled) * (n > 0 ? n : 1));
+    uint64_t *unique = NULL;
+    int built = 0;
+
+    if (xf->fingerprints && count && xor_hash && queue && stack) {
+        for (int attempt = 0; attempt < XF_MAX_ATTEMPTS; attempt++) {
+            built = xf_try_build(xf, keys, n, count, xor_hash, queue, stack);
+            if (built) break;
+            xf->seed = bf_mix64(xf->seed);
+            if (attempt == 1) {
+                // Duplicate keys can never be peeled; after two failures drop them and continue.
+                unique = malloc(sizeof(uint64_t) * (n > 0 ? n : 1));
+                if (!unique) break;
+                memcpy(unique, keys, sizeof(uint64_t) * n);
+                qsort(unique, n, sizeof(uint64_t), compare_u64);
+                size_t m = 0;
+                for (size_t i = 0; i < n; i++) {
+                    if (m == 0 || unique[m - 1] != unique[i]) unique[m++] = unique[i];
+                }
+                keys = unique;
+                n = m;
+            }
+        }
+    }
+
+    free(count);
+    free(xor_hash);
+    free(queue);
+    free(stack);
+    free(unique);
+    if (!built) {
+        fprintf(stderr, "Xor filter construction failed!\n");
+        xf_free(xf);
+        return NULL;
+    }
+    return xf;
+}
+
+void xf_free(XorFilter *xf) {
+    if (xf) {
+        free(xf->fingerprints);
+        free(xf);
+    }
+}
+
+bool xf_member(const XorFilter *xf, uint64_t key) {
+    uint64_t hash = xf_hash(key, xf->seed);
+    return (xf_fingerprint(hash) ^ xf->fingerprints[xf_slot(hash, 0, xf->block_length)] ^
+            xf->fingerprints[xf_slot(hash, 1, xf->block_length)] ^
+            xf->fingerprints[xf_slot(hash, 2, xf->block_length)]) == 0;
+}
+
+uint64_t xf_num_bits(const XorFilter *xf) {
+    return (uint64_t)3 * xf->block_length * 8;
+}
@@ -0,0 +1,35 @@
+/*
+ *  Static xor filter over 64-bit keys: built once from a key array, then query-only.
+ */
+
+#ifndef TEMPLATE_XOR_FILTER_H
+#define TEMPLATE_XOR_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct XorFilter XorFilter;
+
+/**
+ * @brief Builds a filter holding keys[0..n), using about 1.23 * 8 = 9.84 bits per key.
+ * * The false-positive rate is 1/256 (8-bit fingerprints). Duplicate keys are allowed.
+ * Expected O(n) time; the build retries with a new seed in the rare case peeling fails.
+ * @return XorFilter* The new filter, or NULL on failure.
+ */
+XorFilter *xf_build(const uint64_t keys[], size_t n);
+/**
+ * @brief Frees all memory associated with the filter.
+ */
+void xf_free(XorFilter *xf);
+/**
+ * @brief Checks a 64-bit key with exactly three memory accesses.
+ * @return bool true ("Maybe") if the key may be in the set, false ("No") otherwise.
+ */
+bool xf_member(const XorFilter *xf, uint64_t key);
+/**
+ * @brief Returns the size of the fingerprint array in bits.
+ */
+uint64_t xf_num_bits(const XorFilter *xf);
+
+#endif //TEMPLATE_XOR_FILTER_H
@@ -0,0 +1,86 @@
+/*
+ *  Benchmark: static xor filter against the runtime-sized Bloom filter at equal false-positive rate.
+ *  Usage: xor-filter-bench [num_keys] [num_queries]
+ *         (default: 10M keys, 10M queries)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "bloom_filter.h"
+#include "xor_filter.h"
+#include "bench_util.h"
+
+int main(int argc, char *argv[]) {
+    size_t num_keys = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    size_t num_queries = argc > 2 ? strtoull(argv[2], NULL, 10) : 10000000;
+
+    uint64_t *keys = malloc(sizeof(uint64_t) * num_keys);
+    uint64_t *queries = malloc(sizeof(uint64_t) * num_queries);
+    if (!keys || !queries) {
+        fprintf(stderr, "Allocation failed!\n");
+        return 1;
+    }
+    uint64_t state = 13;
+    for (size_t i = 0; i < num_keys; i++) {
+        keys[i] = next_rand(&state);
+    }
+    for (size_t i = 0; i < num_queries; i++) {
+        queries[i] = next_rand(&state);
+    }
+
+    double start = now_sec();
+    XorFilter *xf = xf_build(keys, num_keys);
+    double xf_build_time = now_sec() - start;
+    // The Bloom filter is sized for the xor filter's false-positive rate, 1/256.
+    start = now_sec();
+    BloomFilter64 *bf = bf_create(num_keys, 1.0 / 256);
+    if (!xf || !bf) {
+        return 1;
+    }
+    bf_insert_batch(bf, keys, num_keys);
+    double bf_build_time = now_sec() - start;
+
+    size_t xf_false = 0, bf_false = 0;
+    start = now_sec();
+    for (size_t i = 0; i < num_queries; i++) {
+        xf_false += xf_member(xf, queries[i]);
+    }
+    double xf_query_time = now_sec() - start;
+    start = now_sec();
+    for (size_t i = 0; i < num_queries; i++) {
+        bf_false += bf_member_u64(bf, queries[i]);
+    }
+    double bf_query_time = now_sec() - start;
+
+    size_t xf_missing = 0, bf_missing = 0;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        xf_missing += !xf_member(xf, keys[i]);
+    }
+    double xf_positive_time = now_sec() - start;
+    start = now_sec();
+    for (size_t i = 0; i < num_keys; i++) {
+        bf_missing += !bf_member_u64(bf, keys[i]);
+    }
+    double bf_positive_time = now_sec() - start;
+
+    printf("n=%zu  target FPR %.4f%%\n", num_keys, 100.0 / 256);
+    printf("  xor    %5.2f bits/key  FPR %.4f%%  build %6.3f s  negative %6.1f ns  positive %6.1f ns%s\n",
+           (double)xf_num_bits(xf) / num_keys, 100.0 * xf_false / num_queries, xf_build_time,
+           xf_query_time / num_queries * 1e9, xf_positive_time / num_keys * 1e9,
+           xf_missing ? "  FALSE NEGATIVES" : "");
+    printf("  bloom  %5.2f bits/key  FPR %.4f%%  build %6.3f s  negative %6.1f ns  positive %6.1f ns  k=%d%s\n",
+           (double)bf_num_bits(bf) / num_keys, 100.0 * bf_false / num_queries, bf_build_time,
+           bf_query_time / num_queries * 1e9, bf_positive_time / num_keys * 1e9, bf_num_hashes(bf),
+           bf_missing ? "  FALSE NEGATIVES" : "");
+
+    xf_free(xf);
+    bf_free(bf);
+    free(keys);
+    free(queries);
+    return 0;
+}